@@ -0,0 +1,1242 @@
+// Benchmark común para todas las implementaciones de la lista enlazada.
+// Compilar: gcc -O2 -pthread -o bench *.c -lm
+//           (con -DLIST_STATS imprime además la contención de locks por fase, stats.h)
+// Uso:      ./bench --impl=NOMBRE[,NOMBRE...]|all [--threads=N] [--elements=N] [--searches=N] [--batch=N]
+//                    [--dist=uniform|zipf[:S]|hotspot[:K/O]|sequential] [--hit-rate=P]
+//           ./bench --impl=... --mix=80/10/10 [--key-range=N] [--initial=N] [--ops=N] [--seed=N]
+//                    [--save-ops=ARCHIVO | --replay-ops=ARCHIVO]
+//           ./bench --impl=... --trace=ARCHIVO [--trace-pace=asap|recorded] [--initial=N]
+//           ./bench --csv-to-trace=OPS.csv --trace=ARCHIVO
+//           ./bench --impl=... --sweep [--max-threads=N] [--sizes=N,N] [--trials=N] [--format=csv|json]
+//           Con --drain se mide además el vaciado; --handoff=spin|futex elige la espera entre fases.
+//           Con --duration=10s [--warmup=2s] la búsqueda y la fase mixta corren por tiempo.
+//           ./bench --scan-bench [--elements=N] [--searches=N]
+//           Con --perf cada fase informa además contadores de hardware por operación.
+
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para funciones de manejo de hilos
+#include <string.h>     // Para strcmp
+#include <getopt.h>     // Para leer las opciones de la línea de comandos
+#include <math.h>       // Para sqrt
+#include <time.h>       // Para nanosleep
+#include <stdatomic.h>  // Para el estado de las corridas por tiempo
+
+#include "histogram.h"
+#include "list.h"
+#include "opstream.h"
+#include "perf.h"
+#include "scan.h"
+#include "simd.h"
+#include "spin.h"
+#include "stats.h"
+#include "topology.h"
+#include "trace.h"
+#include "workers.h"
+#include "workload.h"
+
+// Backend que se está midiendo
+static const struct list_impl* impl;
+
+// Claves por lote en la inserción, la búsqueda y la carga inicial
+// (--batch); 0 = una operación por clave
+static int batch_size = 0;
+
+// Flujos de la fase mixta: guardarlos (--save-ops) o leerlos de un archivo
+// en lugar de generarlos (--replay-ops)
+static const char* save_ops_path = NULL;
+static struct op_file replay_ops;
+
+// Traza a repetir en lugar de la fase mixta (--trace). Con trace_paced
+// cada operación espera a su tiempo registrado, contado desde trace_epoch:
+// el comienzo de la medición del primer hilo que sale de la barrera.
+static struct trace_file trace;
+static int trace_paced = 0;
+static _Atomic uint64_t trace_epoch;    // 0 hasta que un hilo lo fija
+
+// Corridas por tiempo (--warmup, --duration): la fase de búsqueda y la
+// mixta repiten sus claves hasta que el hilo principal cambia run_state a
+// RUN_STOP. Sólo cuenta lo hecho en RUN_MEASURE.
+enum { RUN_WARMUP, RUN_MEASURE, RUN_STOP };
+static uint64_t warmup_ns = 0;
+static uint64_t duration_ns = 0;   // 0 = cantidad fija de operaciones
+static atomic_int run_state;
+
+// Todos los hilos de una fase empiezan juntos
+static pthread_barrier_t start_barrier;
+
+// Cómo esperan los hilos persistentes entre fases (--handoff)
+static enum workers_handoff handoff = HANDOFF_FUTEX;
+
+// Borrar todas las claves al final de la corrida, midiendo (--drain)
+static int drain = 0;
+
+// Estructura para los parámetros de los hilos (una línea de caché propia
+// por hilo para que los contadores no compartan línea con los de otro hilo)
+struct thread_data {
+    int id;
+    int num_threads;
+    int steady;              // La fase corre por tiempo (duration_ns)
+    int seen_state;          // Último run_state visto por el hilo
+    uint64_t begin, finish;  // Comienzo y fin de la fase del hilo (now_ns)
+    long warmup_net;         // Inserciones menos borrados del calentamiento
+    struct perf_session perf_session;
+    void* (*phase)(void*);   // Función de la fase actual
+    int num_insert_elements; // Número de elementos a insertar
+    int num_search_elements; // Número de elementos a buscar
+    int *elements;           // Elementos a buscar (arreglo propio del hilo)
+
+    // Carga mixta (--mix)
+    const struct workload* workload;
+    const int* populate_keys;    // Claves iniciales que inserta este hilo
+    int num_populate_keys;
+    long num_ops;                // Operaciones mixtas de este hilo
+
+    // Vaciado (--drain): claves [drain_first, drain_last) que borra este hilo
+    int drain_first;
+    int drain_last;
+    struct op_stream stream;     // Operaciones de la fase mixta, pregeneradas
+
+    long op_hits[OP_COUNT];              // Operaciones que devolvieron 1 por tipo
+    struct histogram latency[OP_COUNT];  // Latencia de cada operación (ns) por tipo
+    struct perf_counts perf;             // Contadores de hardware de la fase (--perf)
+} __attribute__((aligned(64)));
+
+// Vaciar los contadores de un hilo antes de una fase
+static void reset_counters(struct thread_data* data) {
+    for (int t = 0; t < OP_COUNT; t++) {
+        data->op_hits[t] = 0;
+        hist_reset(&data->latency[t]);
+    }
+    perf_counts_reset(&data->perf);
+}
+
+// En una fase por tiempo: 0 cuando hay que parar. Al terminar el
+// calentamiento descarta todo lo contado hasta ahí.
+static inline int keep_running(struct thread_data* data) {
+    int state = atomic_load_explicit(&run_state, memory_order_relaxed);
+    if (state != data->seen_state) {
+        // También si el hilo no llegó a ver RUN_MEASURE: no midió nada
+        int warming = data->seen_state == RUN_WARMUP;
+        data->seen_state = state;
+        if (warming) {
+            data->warmup_net += data->op_hits[OP_INSERT] - data->op_hits[OP_DELETE];
+            reset_counters(data);
+            stats_thread_reset();
+            perf_thread_reset(&data->perf_session);
+        }
+    }
+    return state != RUN_STOP;
+}
+
+// Ejecutar una operación midiendo su latencia. `*start` es el fin de la
+// operación anterior, así se lee el reloj una sola vez por operación.
+static inline void timed_op(struct thread_data* data, enum op_type op, int key, uint64_t* start) {
+    int result;
+    switch (op) {
+    case OP_MEMBER: result = impl->Member(key); break;
+    case OP_INSERT: result = impl->Insert(key); break;
+    default:        result = impl->Delete(key); break;
+    }
+    uint64_t end = now_ns();
+    hist_record(&data->latency[op], end - *start);
+    data->op_hits[op] += (result == 1);
+    stats_op_done(1);
+    *start = end;
+}
+
+// Ejecutar un lote ordenado de claves. Cada clave registra la latencia
+// amortizada del lote (duración del lote / claves).
+static inline void timed_batch(struct thread_data* data, enum op_type op, const int* keys, int n,
+                               uint64_t* start) {
+    int hits;
+    switch (op) {
+    case OP_MEMBER: hits = list_member_batch(impl, keys, n, NULL); break;
+    case OP_INSERT: hits = list_insert_batch(impl, keys, n, NULL); break;
+    default:        hits = list_delete_batch(impl, keys, n, NULL); break;
+    }
+    uint64_t end = now_ns();
+    uint64_t per_key = (end - *start) / n;
+    for (int i = 0; i < n; i++) {
+        hist_record(&data->latency[op], per_key);
+    }
+    data->op_hits[op] += hits > 0 ? hits : 0;
+    stats_op_done(n);
+    *start = end;
+}
+
+static int compare_ints(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Función que ejecuta cada hilo para insertar elementos
+static void* thread_insert(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    int id = data->id;
+    int num_elements = data->num_insert_elements;
+
+    // Cada hilo inserta `num_elements` valores secuenciales
+    uint64_t start = now_ns();
+    if (batch_size > 0) {
+        int* keys = malloc((size_t)batch_size * sizeof(int));
+        if (keys == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            exit(EXIT_FAILURE);
+        }
+        start = now_ns();
+        for (int i = 0; i < num_elements; i += batch_size) {
+            int n = num_elements - i < batch_size ? num_elements - i : batch_size;
+            for (int j = 0; j < n; j++) {
+                keys[j] = id * num_elements + i + j;
+            }
+            timed_batch(data, OP_INSERT, keys, n, &start);
+        }
+        free(keys);
+        return NULL;
+    }
+    for (int i = 0; i < num_elements; i++) {
+        timed_op(data, OP_INSERT, id * num_elements + i, &start);
+    }
+
+    return NULL;
+}
+
+// Función que ejecuta cada hilo para buscar elementos
+static void* thread_search(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    int num_elements = data->num_search_elements;
+
+    // Cada hilo busca `num_elements` valores de su tramo (con --batch, cada
+    // lote ya viene ordenado). Por tiempo, vuelve a empezar el tramo.
+    if (num_elements == 0)
+        return NULL;
+    uint64_t start = now_ns();
+    if (batch_size > 0) {
+        for (int i = 0; data->steady ? keep_running(data) : i < num_elements; i += batch_size) {
+            if (i >= num_elements)
+                i = 0;
+            int n = num_elements - i < batch_size ? num_elements - i : batch_size;
+            timed_batch(data, OP_MEMBER, data->elements + i, n, &start);
+        }
+        return NULL;
+    }
+    for (int i = 0; data->steady ? keep_running(data) : i < num_elements; i++) {
+        if (i == num_elements)
+            i = 0;
+        timed_op(data, OP_MEMBER, data->elements[i], &start);
+    }
+
+    return NULL;
+}
+
+// Función que ejecuta cada hilo para cargar los elementos iniciales
+static void* thread_populate(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    int n = data->num_populate_keys;
+
+    if (batch_size > 0 && n > 0) {
+        // Ordenar una copia del tramo y cargarlo por lotes
+        int* keys = malloc((size_t)n * sizeof(int));
+        if (keys == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            exit(EXIT_FAILURE);
+        }
+        memcpy(keys, data->populate_keys, (size_t)n * sizeof(int));
+        qsort(keys, n, sizeof(int), compare_ints);
+        for (int i = 0; i < n; i += batch_size) {
+            list_insert_batch(impl, keys + i, n - i < batch_size ? n - i : batch_size, NULL);
+        }
+        free(keys);
+        return NULL;
+    }
+    for (int i = 0; i < n; i++) {
+        impl->Insert(data->populate_keys[i]);
+    }
+
+    return NULL;
+}
+
+// Función que ejecuta cada hilo para vaciar la lista: borra su tramo de claves
+static void* thread_drain(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    int first = data->drain_first, last = data->drain_last;
+
+    uint64_t start = now_ns();
+    if (batch_size > 0) {
+        int* keys = malloc((size_t)batch_size * sizeof(int));
+        if (keys == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            exit(EXIT_FAILURE);
+        }
+        start = now_ns();
+        for (int k = first; k < last; k += batch_size) {
+            int n = last - k < batch_size ? last - k : batch_size;
+            for (int j = 0; j < n; j++) {
+                keys[j] = k + j;
+            }
+            timed_batch(data, OP_DELETE, keys, n, &start);
+        }
+        free(keys);
+        return NULL;
+    }
+    for (int k = first; k < last; k++) {
+        timed_op(data, OP_DELETE, k, &start);
+    }
+
+    return NULL;
+}
+
+// Función que ejecuta cada hilo para la fase mixta
+static void* thread_mixed(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    const struct op_entry* ops = data->stream.ops;
+    long count = data->stream.count;
+
+    // Por tiempo, el flujo vuelve a empezar al terminarse
+    if (count == 0)
+        return NULL;
+    uint64_t start = now_ns();
+    for (long i = 0; data->steady ? keep_running(data) : i < count; i++) {
+        if (i == count)
+            i = 0;
+        timed_op(data, (enum op_type)ops[i].op, ops[i].key, &start);
+    }
+
+    return NULL;
+}
+
+// Esperar hasta `deadline` (now_ns): durmiendo si falta mucho, activamente al final
+static void wait_until(uint64_t deadline) {
+    unsigned spins = 0;
+    for (;;) {
+        uint64_t now = now_ns();
+        if (now >= deadline)
+            return;
+        if (deadline - now > 200000) {
+            struct timespec ts = { 0, (long)(deadline - now - 100000) };
+            nanosleep(&ts, NULL);
+        } else {
+            spin_relax(&spins);
+        }
+    }
+}
+
+// Función que ejecuta cada hilo para repetir su parte de la traza
+static void* thread_trace(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    struct trace_reader reader;
+    if (trace_reader_init(&reader, &trace, data->id, data->num_threads) != 0) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // El primer hilo en llegar fija el origen de la traza; los demás lo usan
+    uint64_t epoch = 0;
+    if (atomic_compare_exchange_strong(&trace_epoch, &epoch, data->begin))
+        epoch = data->begin;
+
+    uint64_t start = now_ns();
+    for (const struct trace_record* rec = trace_reader_next(&reader); rec != NULL;
+         rec = trace_reader_next(&reader)) {
+        if (trace_paced && now_ns() < epoch + rec->time_ns) {
+            // La espera no cuenta como latencia de la operación
+            wait_until(epoch + rec->time_ns);
+            start = now_ns();
+        }
+        timed_op(data, (enum op_type)rec->op, rec->key, &start);
+    }
+
+    trace_reader_free(&reader);
+    return NULL;
+}
+
+// Generar las claves de búsqueda del hilo (fuera de la medición). Cada
+// hilo usa su propio generador y escribe su propio arreglo, así la memoria
+// queda en su nodo NUMA. Con probabilidad 1 - hit_rate la clave se corre
+// a [key_range, 2 * key_range), donde no hay nada.
+static void* thread_gen_search(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    const struct workload* w = data->workload;
+    int n = data->num_search_elements;
+
+    size_t size = ((size_t)(n > 0 ? n : 1) * sizeof(int) + 63) & ~(size_t)63;
+    int* keys = aligned_alloc(64, size);
+    if (keys == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+
+    struct key_stream stream;
+    workload_stream_init(w, &stream, data->id, data->num_threads);
+    for (int j = 0; j < n; j++) {
+        keys[j] = workload_next_key(w, &stream);
+        if (w->hit_rate < 1.0 && workload_uniform(&stream.rng) >= w->hit_rate)
+            keys[j] += w->key_range;
+    }
+    // Los lotes deben ir ordenados
+    for (int j = 0; batch_size > 0 && j < n; j += batch_size) {
+        qsort(keys + j, n - j < batch_size ? n - j : batch_size, sizeof(int), compare_ints);
+    }
+
+    data->elements = keys;
+    return NULL;
+}
+
+// Generar el flujo de la fase mixta del hilo (fuera de la medición)
+static void* thread_gen_mixed(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+    if (op_stream_generate(&data->stream, data->workload, data->id, data->num_threads,
+                           data->num_ops) != 0) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+    return NULL;
+}
+
+// Al crearse cada hilo de trabajo: fijarlo y registrarlo en el backend
+static void worker_start(int id) {
+    placement_apply(id);
+    if (impl->thread_init != NULL)
+        impl->thread_init();
+}
+
+// Al terminar la corrida
+static void worker_stop(int id) {
+    (void)id;
+    if (impl->thread_exit != NULL)
+        impl->thread_exit();
+}
+
+// Cuerpo de cada fase en cada hilo
+static void* thread_main(void* arg) {
+    struct thread_data* data = (struct thread_data*)arg;
+
+    // Abrir los contadores antes de la barrera: la apertura no cuenta en el tiempo
+    perf_thread_open(&data->perf_session);
+    pthread_barrier_wait(&start_barrier);
+    data->begin = now_ns();
+    perf_thread_start(&data->perf_session);
+    data->phase(arg);
+    data->finish = now_ns();
+    perf_thread_end(&data->perf_session, &data->perf);
+    stats_thread_flush();
+
+    return NULL;
+}
+
+// Dormir `ns` nanosegundos
+static void sleep_ns(uint64_t ns) {
+    struct timespec ts = { (time_t)(ns / 1000000000u), (long)(ns % 1000000000u) };
+    while (nanosleep(&ts, &ts) != 0)
+        ;
+}
+
+// Ejecutar `fn` en los `ths` hilos del grupo, esperar a que terminen y
+// devolver el tiempo de reloj de pared de la fase en segundos. Los hilos
+// arrancan juntos en una barrera, así el traspaso queda fuera de la medición. Con
+// `steady` y --duration la fase corre por tiempo: primero --warmup sin
+// contar y después --duration midiendo.
+static double run_phase(int ths, struct worker_pool* workers, struct thread_data* thread_args,
+                        void* (*fn)(void*), int steady) {
+    steady = steady && duration_ns > 0;
+    int initial_state = steady && warmup_ns > 0 ? RUN_WARMUP : RUN_MEASURE;
+    atomic_store(&run_state, initial_state);
+    for (int i = 0; i < ths; i++) {
+        reset_counters(&thread_args[i]);
+        thread_args[i].phase = fn;
+        thread_args[i].steady = steady;
+        thread_args[i].seen_state = initial_state;
+        thread_args[i].warmup_net = 0;
+    }
+    stats_reset();
+    pthread_barrier_init(&start_barrier, NULL, (unsigned)ths + 1);
+
+    workers_start(workers, thread_main, thread_args, sizeof(struct thread_data));
+    pthread_barrier_wait(&start_barrier);
+    uint64_t start = now_ns();
+    uint64_t end = 0;
+
+    if (steady) {
+        if (warmup_ns > 0) {
+            sleep_ns(warmup_ns);
+            atomic_store(&run_state, RUN_MEASURE);
+            start = now_ns();
+        }
+        sleep_ns(duration_ns);
+        atomic_store(&run_state, RUN_STOP);
+        end = now_ns();
+    }
+    workers_wait(workers);
+    for (int i = 0; i < ths; i++) {
+        // Sin tiempo fijo la fase va del primer hilo que arrancó al último
+        // que terminó (el hilo principal puede despertar tarde de la barrera)
+        if (!steady) {
+            if (i == 0 || thread_args[i].begin < start)
+                start = thread_args[i].begin;
+            if (thread_args[i].finish > end)
+                end = thread_args[i].finish;
+        }
+    }
+    pthread_barrier_destroy(&start_barrier);
+    return (end - start) / 1e9;
+}
+
+// Imprimir el rendimiento de una fase y las latencias por tipo de operación
+static void print_phase(const char* phase, double wall_time, int ths,
+                        const struct thread_data* thread_args) {
+    struct histogram* merged = calloc(OP_COUNT, sizeof(struct histogram));
+    long op_hits[OP_COUNT] = {0};
+    struct perf_counts perf;
+    perf_counts_reset(&perf);
+    if (merged == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+
+    uint64_t total_ops = 0;
+    for (int i = 0; i < ths; i++) {
+        for (int t = 0; t < OP_COUNT; t++) {
+            hist_merge(&merged[t], &thread_args[i].latency[t]);
+            op_hits[t] += thread_args[i].op_hits[t];
+        }
+        perf_counts_merge(&perf, &thread_args[i].perf);
+    }
+    for (int t = 0; t < OP_COUNT; t++) {
+        total_ops += merged[t].count;
+    }
+
+    printf("  Fase %s: %.6f segundos, %.0f ops/s\n",
+           phase, wall_time, wall_time > 0 ? total_ops / wall_time : 0.0);
+    printf("    %-8s %10s %11s %8s %8s %8s %8s %8s %10s\n",
+           "Latencia", "ops", "con éxito", "p50", "p90", "p99", "p99.9", "media", "max (ns)");
+    for (int t = 0; t < OP_COUNT; t++) {
+        const struct histogram* h = &merged[t];
+        if (h->count == 0)
+            continue;
+        printf("    %-8s %10llu %10ld %8llu %8llu %8llu %8llu %8.0f %10llu\n",
+               op_names[t], (unsigned long long)h->count, op_hits[t],
+               (unsigned long long)hist_percentile(h, 50.0),
+               (unsigned long long)hist_percentile(h, 90.0),
+               (unsigned long long)hist_percentile(h, 99.0),
+               (unsigned long long)hist_percentile(h, 99.9),
+               (double)h->sum / h->count,
+               (unsigned long long)h->max);
+    }
+    if (perf_enabled())
+        perf_report(stdout, &perf, total_ops);
+    stats_report(stdout);
+
+    free(merged);
+}
+
+// Reservar los parámetros de los hilos alineados a línea de caché
+static struct thread_data* alloc_thread_args(int ths) {
+    size_t size = (size_t)ths * sizeof(struct thread_data);
+    struct thread_data* thread_args = aligned_alloc(64, size);
+    if (thread_args != NULL)
+        memset(thread_args, 0, size);
+    return thread_args;
+}
+
+static void usage(const char* prog) {
+    fprintf(stderr,
+            "Uso: %s --impl=NOMBRE [opciones]\n"
+            "  --impl=NOMBRE      implementación de la lista (all = todas, o varias separadas por comas)\n"
+            "  --threads=N        número de hilos (por defecto 16)\n"
+            "  --elements=N       elementos a insertar (por defecto 1000)\n"
+            "  --searches=N       elementos a buscar (por defecto 100000)\n"
+            "  --hit-rate=P       porcentaje de búsquedas de claves presentes (por defecto 100)\n"
+            "  --dist=DIST        claves de búsqueda y de la carga mixta: uniform, zipf[:S]\n"
+            "                     (0 < S < 1, por defecto 0.99), hotspot[:K/O] (el O %% de las\n"
+            "                     operaciones en el K %% de las claves, por defecto 20/80) o\n"
+            "                     sequential (por defecto uniform)\n"
+            "  --batch=N          insertar, buscar y cargar en lotes ordenados de N claves\n"
+            "Carga mixta:\n"
+            "  --mix=M/I/D        porcentajes Member/Insert/Delete (p. ej. 99.9/0.05/0.05)\n"
+            "  --key-range=N      claves en [0, N) (por defecto 2 * initial)\n"
+            "  --initial=N        elementos cargados antes de medir (por defecto 1000)\n"
+            "  --ops=N            operaciones mixtas en total (por defecto 100000)\n"
+            "  --seed=N           semilla de los generadores (por defecto 1)\n"
+            "  --save-ops=ARCHIVO guardar los flujos de operaciones generados para cada hilo\n"
+            "  --replay-ops=ARCHIVO repetir los flujos guardados (mmap; mismo número de hilos)\n"
+            "Corridas por tiempo (búsqueda y fase mixta):\n"
+            "  --duration=T       medir durante T (p. ej. 10s, 500ms) en lugar de un número fijo de ops\n"
+            "  --warmup=T         correr antes T sin medir (por defecto 0)\n"
+            "Hilos de trabajo (se crean una vez por corrida):\n"
+            "  --handoff=MODO     espera entre fases: futex o spin (por defecto futex)\n"
+            "  --drain            al final, borrar todas las claves midiendo la fase de vaciado\n"
+            "Trazas (trace.h):\n"
+            "  --trace=ARCHIVO    repetir una traza binaria en lugar de la fase mixta\n"
+            "                     (la lista empieza vacía salvo con --initial)\n"
+            "  --trace-pace=MODO  asap (lo más rápido posible) o recorded (a los tiempos registrados)\n"
+            "  --csv-to-trace=CSV convertir tiempo_ns,hilo,operación,clave en la traza de --trace\n"
+            "Barrido (--sweep, usa la carga mixta, por defecto 80/10/10):\n"
+            "  --sweep            medir con 1, 2, 4, ... hasta --max-threads hilos\n"
+            "  --max-threads=N    máximo de hilos del barrido (por defecto --threads)\n"
+            "  --sizes=N,N,...    tamaños iniciales de la lista (claves en [0, 2N))\n"
+            "  --trials=N         repeticiones de cada punto (por defecto 3)\n"
+            "  --format=FORMATO   text, csv o json (por defecto text)\n"
+            "Franjas (--impl=striped):\n"
+            "  --stripes=N        franjas de claves, cada una con su lista y su lock (por defecto 16,\n"
+            "                     máximo 1024)\n"
+            "Ubicación de los hilos:\n"
+            "  --pin=POLÍTICA     none, compact o scatter (por defecto none)\n"
+            "  --numa-node=N      usar sólo las CPUs y la memoria del nodo NUMA N\n"
+            "Contadores de hardware:\n"
+            "  --perf             contar ciclos, instrucciones y fallos de caché y de salto por op\n"
+            "  --perf-raw=CÓDIGO  contar además un evento crudo de la CPU (p. ej. HITM)\n"
+            "Listas desenrolladas:\n"
+            "  --simd=VERSION     búsqueda en el nodo: auto, scalar, sse2, avx2 (por defecto auto)\n"
+            "  --scan-bench       comparar Member de global y unrolled con cada versión, en un hilo\n"
+            "Implementaciones:\n", prog);
+    list_print_impls(stderr);
+}
+
+// Leer un entero positivo de una opción
+static int parse_positive(const char* opt, const char* arg) {
+    char* end;
+    long value = strtol(arg, &end, 10);
+    if (*arg == '\0' || *end != '\0' || value <= 0 || value > 1000000000L) {
+        fprintf(stderr, "Valor inválido para --%s: %s\n", opt, arg);
+        exit(EXIT_FAILURE);
+    }
+    return (int)value;
+}
+
+// Leer un entero no negativo de una opción
+static int parse_nonnegative(const char* opt, const char* arg) {
+    return arg[0] == '0' && arg[1] == '\0' ? 0 : parse_positive(opt, arg);
+}
+
+// Leer una duración en nanosegundos: número con unidad s, ms o us (sin
+// unidad, segundos)
+static uint64_t parse_duration(const char* opt, const char* arg) {
+    char* end;
+    double value = strtod(arg, &end);
+    double scale = 1e9;
+    if (strcmp(end, "ms") == 0)
+        scale = 1e6;
+    else if (strcmp(end, "us") == 0)
+        scale = 1e3;
+    else if (strcmp(end, "s") != 0 && *end != '\0')
+        value = -1;
+    if (end == arg || value < 0 || value * scale > 1e13) {
+        fprintf(stderr, "Valor inválido para --%s: %s\n", opt, arg);
+        exit(EXIT_FAILURE);
+    }
+    return (uint64_t)(value * scale);
+}
+
+// Recorrido de comprobación de la lista final (ForEach)
+struct list_check {
+    long count;
+    int last;
+    int sorted;
+};
+
+static void check_key(int value, void* arg) {
+    struct list_check* check = (struct list_check*)arg;
+    if (check->count > 0 && value <= check->last)
+        check->sorted = 0;
+    check->last = value;
+    check->count++;
+}
+
+// Borrar todas las claves en [0, key_range) repartidas entre los hilos
+// e informar cuántas quedaron
+static void run_drain(int ths, struct worker_pool* workers, struct thread_data* thread_args,
+                      int key_range) {
+    for (int i = 0; i < ths; i++) {
+        thread_args[i].drain_first = (int)((long)key_range * i / ths);
+        thread_args[i].drain_last = (int)((long)key_range * (i + 1) / ths);
+    }
+    double drain_time = run_phase(ths, workers, thread_args, thread_drain, 0);
+    print_phase("de vaciado", drain_time, ths, thread_args);
+    if (impl->ForEach != NULL) {
+        struct list_check check = { .count = 0, .last = 0, .sorted = 1 };
+        impl->ForEach(check_key, &check);
+        printf("  Tamaño tras vaciar: %ld\n", check.count);
+    }
+}
+
+// Ejecutar las fases de inserción y búsqueda sobre el backend actual
+static void run_benchmark(int ths, int total_elements, int consulta, const struct workload* base) {
+    // Las búsquedas fallidas usan claves en [total, 2 * total)
+    list_set_key_range(base->hit_rate < 1.0 ? 2 * total_elements : total_elements);
+    impl->init();
+
+    const int elements_per_thread = total_elements / ths; // Elementos por hilo
+    const int searches_per_thread = consulta / ths;
+
+    struct thread_data* thread_args = alloc_thread_args(ths);
+    struct worker_pool* workers = workers_create(ths, handoff, worker_start, worker_stop);
+    if (thread_args == NULL || workers == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+
+    printf("Implementación: %s, hilos: %d, búsquedas: %s, aciertos %.0f %%\n",
+           impl->name, ths, workload_dist_name(base), 100.0 * base->hit_rate);
+
+    // Hilos para inserción
+    for (int i = 0; i < ths; i++) {
+        thread_args[i].id = i;
+        thread_args[i].num_threads = ths;
+        thread_args[i].num_insert_elements = elements_per_thread;
+    }
+    double insertion_time = run_phase(ths, workers, thread_args, thread_insert, 0);
+    print_phase("de inserción", insertion_time, ths, thread_args);
+
+    // Claves de búsqueda: cada hilo genera las suyas con la distribución
+    // elegida sobre las claves insertadas
+    struct workload w = *base;
+    int inserted = elements_per_thread * ths;
+    w.key_range = inserted > 0 ? inserted : 1;
+    workload_prepare(&w);
+    for (int i = 0; i < ths; i++) {
+        thread_args[i].workload = &w;
+        thread_args[i].num_search_elements = searches_per_thread; // Cada hilo busca elementos equitativamente
+    }
+    run_phase(ths, workers, thread_args, thread_gen_search, 0);
+
+    // Hilos para búsqueda
+    double search_time = run_phase(ths, workers, thread_args, thread_search, 1);
+    print_phase("de búsqueda", search_time, ths, thread_args);
+
+    if (drain)
+        run_drain(ths, workers, thread_args, inserted);
+
+    workers_destroy(workers); // Antes de destroy: los hilos devuelven sus cachés al backend
+    impl->destroy();
+    for (int i = 0; i < ths; i++) {
+        free(thread_args[i].elements);
+    }
+    free(thread_args);
+}
+
+// Resultado de una corrida de la fase mixta
+struct mixed_result {
+    double seconds;     // Tiempo de reloj de pared de la fase mixta
+    uint64_t ops;       // Operaciones ejecutadas
+};
+
+// Cargar la lista y ejecutar la fase mixta sobre el backend actual.
+// Con verbose imprime el rendimiento y las latencias.
+static struct mixed_result run_mixed(int ths, const struct workload* base, int verbose) {
+    struct workload prepared = *base;
+    const struct workload* w = &prepared;
+    workload_prepare(&prepared);
+    list_set_key_range(w->key_range);
+    impl->init();
+
+    struct thread_data* thread_args = alloc_thread_args(ths);
+    struct worker_pool* workers = workers_create(ths, handoff, worker_start, worker_stop);
+    int* initial_keys = workload_initial_keys(w);
+    if (thread_args == NULL || workers == NULL || initial_keys == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Carga inicial: cada hilo inserta un tramo de las claves
+    for (int i = 0; i < ths; i++) {
+        int begin = (int)((long)w->initial * i / ths);
+        int end = (int)((long)w->initial * (i + 1) / ths);
+        thread_args[i].id = i;
+        thread_args[i].num_threads = ths;
+        thread_args[i].workload = w;
+        thread_args[i].populate_keys = initial_keys + begin;
+        thread_args[i].num_populate_keys = end - begin;
+    }
+    run_phase(ths, workers, thread_args, thread_populate, 0);
+
+    // Fase mixta: las operaciones se reparten entre los hilos
+    for (int i = 0; i < ths; i++) {
+        thread_args[i].num_ops = w->ops * (i + 1) / ths - w->ops * i / ths;
+    }
+    void* (*phase)(void*) = thread_mixed;
+    if (trace.map != NULL) {
+        // Las operaciones salen de la traza
+        phase = thread_trace;
+        atomic_store(&trace_epoch, 0); // Lo fija el primer hilo tras la barrera
+    } else if (replay_ops.streams != NULL) {
+        // Un flujo del archivo por hilo, leído directamente del mmap
+        for (int i = 0; i < ths; i++) {
+            thread_args[i].stream = replay_ops.streams[i];
+        }
+    } else {
+        run_phase(ths, workers, thread_args, thread_gen_mixed, 0);
+        if (save_ops_path != NULL) {
+            struct op_stream* streams = malloc((size_t)ths * sizeof(struct op_stream));
+            if (streams == NULL) {
+                fprintf(stderr, "Error de asignación de memoria\n");
+                exit(EXIT_FAILURE);
+            }
+            for (int i = 0; i < ths; i++) {
+                streams[i] = thread_args[i].stream;
+            }
+            if (op_file_save(save_ops_path, streams, ths) != 0) {
+                fprintf(stderr, "No se pudo escribir %s\n", save_ops_path);
+                exit(EXIT_FAILURE);
+            }
+            free(streams);
+        }
+    }
+    struct mixed_result result;
+    result.seconds = run_phase(ths, workers, thread_args, phase, phase == thread_mixed);
+    result.ops = 0;
+
+    long inserted = 0, deleted = 0;
+    for (int i = 0; i < ths; i++) {
+        inserted += thread_args[i].op_hits[OP_INSERT] + thread_args[i].warmup_net;
+        deleted += thread_args[i].op_hits[OP_DELETE];
+        for (int t = 0; t < OP_COUNT; t++) {
+            result.ops += thread_args[i].latency[t].count;
+        }
+    }
+
+    if (verbose) {
+        printf("Implementación: %s, hilos: %d, claves: [0, %d) %s, iniciales: %d\n",
+               impl->name, ths, w->key_range,
+               trace.map != NULL ? "de la traza" : workload_dist_name(w), w->initial);
+        print_phase("mixta", result.seconds, ths, thread_args);
+        printf("  Tamaño final esperado: %ld\n", w->initial + inserted - deleted);
+        if (impl->ForEach != NULL) {
+            struct list_check check = { .count = 0, .last = 0, .sorted = 1 };
+            impl->ForEach(check_key, &check);
+            printf("  Tamaño final recorrido: %ld, %s\n", check.count,
+                   check.sorted ? "en orden" : "FUERA DE ORDEN");
+        }
+        if (drain)
+            run_drain(ths, workers, thread_args, w->key_range);
+    }
+
+    workers_destroy(workers); // Antes de destroy: los hilos devuelven sus cachés al backend
+    impl->destroy();
+    for (int i = 0; i < ths; i++) {
+        op_stream_free(&thread_args[i].stream); // No libera nada si viene del archivo
+    }
+    free(initial_keys);
+    free(thread_args);
+    return result;
+}
+
+// Parámetros del barrido (--sweep)
+struct sweep_config {
+    int max_threads;        // Se prueban 1, 2, 4, ... hasta max_threads
+    int sizes[32];          // Tamaños iniciales de la lista
+    int num_sizes;
+    int trials;             // Repeticiones de cada punto
+    const char* format;     // text, csv o json
+    const char* mix;        // Mezcla de operaciones, para el encabezado
+};
+
+// Leer una lista de tamaños separados por comas
+static int parse_sizes(const char* arg, struct sweep_config* sweep) {
+    sweep->num_sizes = 0;
+    const char* p = arg;
+    while (*p != '\0') {
+        char* end;
+        long value = strtol(p, &end, 10);
+        if (end == p || value <= 0 || value > 100000000L || sweep->num_sizes == 32)
+            return -1;
+        sweep->sizes[sweep->num_sizes++] = (int)value;
+        if (*end == ',')
+            end++;
+        else if (*end != '\0')
+            return -1;
+        p = end;
+    }
+    return sweep->num_sizes > 0 ? 0 : -1;
+}
+
+// Imprimir un punto del barrido
+static void print_sweep_row(const struct sweep_config* sweep, int first, int ths,
+                            const struct workload* w, double mean, double stddev,
+                            double min, double ops_per_s, double speedup) {
+    if (strcmp(sweep->format, "csv") == 0) {
+        printf("%s,%d,%d,%d,%d,%.9f,%.9f,%.9f,%.1f,%.4f\n", impl->name, ths, w->initial,
+               w->key_range, sweep->trials, mean, stddev, min, ops_per_s, speedup);
+    } else if (strcmp(sweep->format, "json") == 0) {
+        printf("%s    {\"impl\": \"%s\", \"threads\": %d, \"elements\": %d, \"key_range\": %d, "
+               "\"trials\": %d, \"mean_s\": %.9f, \"stddev_s\": %.9f, \"min_s\": %.9f, "
+               "\"ops_per_s\": %.1f, \"speedup\": %.4f}",
+               first ? "" : ",\n", impl->name, ths, w->initial, w->key_range, sweep->trials,
+               mean, stddev, min, ops_per_s, speedup);
+    } else {
+        printf("%-13s %7d %10d %12.6f %12.6f %12.6f %14.0f %8.2fx\n", impl->name, ths,
+               w->initial, mean, stddev, min, ops_per_s, speedup);
+    }
+}
+
+// Siguiente número de hilos del barrido: potencias de dos y al final el máximo
+static int next_thread_count(int ths, int max_threads) {
+    if (ths == max_threads)
+        return max_threads + 1;
+    return ths * 2 < max_threads ? ths * 2 : max_threads;
+}
+
+// Barrer hilos y tamaños con varias repeticiones y emitir los resultados
+static void run_sweep(const struct list_impl* const* impls, int num_impls,
+                      const struct sweep_config* sweep, const struct workload* base) {
+    int csv = strcmp(sweep->format, "csv") == 0;
+    int json = strcmp(sweep->format, "json") == 0;
+    int first = 1;
+
+    if (csv)
+        printf("impl,threads,elements,key_range,trials,mean_s,stddev_s,min_s,ops_per_s,speedup\n");
+    else if (json)
+        printf("{\n  \"mix\": \"%s\",\n  \"ops\": %ld,\n  \"seed\": %llu,\n  \"results\": [\n",
+               sweep->mix, base->ops, (unsigned long long)base->seed);
+    else
+        printf("%-13s %7s %10s %12s %12s %12s %14s %9s\n", "impl", "hilos", "elementos",
+               "media (s)", "desv. (s)", "mín (s)", "ops/s", "speedup");
+
+    for (int m = 0; m < num_impls; m++) {
+        impl = impls[m];
+        for (int s = 0; s < sweep->num_sizes; s++) {
+            struct workload w = *base;
+            w.initial = sweep->sizes[s];
+            w.key_range = 2 * sweep->sizes[s];
+            double base_ops_per_s = 0.0;
+
+            for (int ths = 1; ths <= sweep->max_threads; ths = next_thread_count(ths, sweep->max_threads)) {
+                double sum = 0.0, sum_sq = 0.0, min = 0.0;
+                double sum_rate = 0.0; // ops/s de cada repetición, con sus propias ops
+                for (int trial = 0; trial < sweep->trials; trial++) {
+                    struct mixed_result r = run_mixed(ths, &w, 0);
+                    sum += r.seconds;
+                    sum_sq += r.seconds * r.seconds;
+                    if (trial == 0 || r.seconds < min)
+                        min = r.seconds;
+                    sum_rate += r.seconds > 0 ? r.ops / r.seconds : 0.0;
+                }
+                double mean = sum / sweep->trials;
+                double var = sweep->trials > 1
+                             ? (sum_sq - sum * mean) / (sweep->trials - 1) : 0.0;
+                double stddev = var > 0 ? sqrt(var) : 0.0;
+                double ops_per_s = sum_rate / sweep->trials;
+                if (ths == 1)
+                    base_ops_per_s = ops_per_s;
+                double speedup = base_ops_per_s > 0 ? ops_per_s / base_ops_per_s : 0.0;
+
+                print_sweep_row(sweep, first, ths, &w, mean, stddev, min, ops_per_s, speedup);
+                first = 0;
+                fflush(stdout);
+            }
+        }
+    }
+
+    if (json)
+        printf("\n  ]\n}\n");
+}
+
+int main(int argc, char* argv[]) {
+    int ths = 16;               // Número de hilos
+    int total_elements = 1000;  // Total de elementos a insertar
+    int consulta = 100000;      // Número de elementos a buscar
+    const char* impl_name = NULL;
+    const char* mix = NULL;     // Carga mixta (--mix)
+    const char* simd = "auto";  // Búsqueda dentro de los nodos (--simd)
+    int scan_bench = 0;
+    const char* pin = "none";   // Ubicación de los hilos (--pin)
+    int numa_node = -1;         // Nodo NUMA (--numa-node)
+    int perf = 0;               // Contadores de hardware (--perf)
+    uint64_t perf_raw = 0;      // Evento crudo (--perf-raw)
+    const char* replay_path = NULL; // Flujos a repetir (--replay-ops)
+    const char* trace_path = NULL;  // Traza a repetir o a escribir (--trace)
+    const char* csv_path = NULL;    // CSV a convertir (--csv-to-trace)
+    int initial_set = 0;            // Se dio --initial
+    int sweep_mode = 0;         // Barrido de hilos y tamaños (--sweep)
+    struct sweep_config sweep = {
+        .max_threads = 0,
+        .num_sizes = 0,
+        .trials = 3,
+        .format = "text",
+    };
+    struct workload w = {
+        .key_range = 0,
+        .initial = 1000,
+        .ops = 100000,
+        .seed = 1,
+        .dist = KEY_UNIFORM,
+        .zipf_skew = 0.99,
+        .hot_keys = 0.2,
+        .hot_ops = 0.8,
+        .hit_rate = 1.0,
+    };
+
+    static const struct option options[] = {
+        {"impl",     required_argument, NULL, 'i'},
+        {"threads",  required_argument, NULL, 't'},
+        {"elements", required_argument, NULL, 'e'},
+        {"searches", required_argument, NULL, 's'},
+        {"mix",       required_argument, NULL, 'm'},
+        {"key-range", required_argument, NULL, 'k'},
+        {"initial",   required_argument, NULL, 'n'},
+        {"ops",       required_argument, NULL, 'o'},
+        {"seed",      required_argument, NULL, 'r'},
+        {"simd",      required_argument, NULL, 'v'},
+        {"scan-bench", no_argument,      NULL, 'b'},
+        {"pin",       required_argument, NULL, 'p'},
+        {"numa-node", required_argument, NULL, 'u'},
+        {"sweep",     no_argument,       NULL, 'S'},
+        {"max-threads", required_argument, NULL, 'T'},
+        {"sizes",     required_argument, NULL, 'Z'},
+        {"trials",    required_argument, NULL, 'R'},
+        {"format",    required_argument, NULL, 'F'},
+        {"batch",     required_argument, NULL, 'B'},
+        {"stripes",   required_argument, NULL, 'K'},
+        {"dist",      required_argument, NULL, 'D'},
+        {"hit-rate",  required_argument, NULL, 'H'},
+        {"handoff",   required_argument, NULL, 'j'},
+        {"drain",     no_argument,       NULL, 'g'},
+        {"duration",  required_argument, NULL, 'd'},
+        {"warmup",    required_argument, NULL, 'w'},
+        {"trace",     required_argument, NULL, 'X'},
+        {"trace-pace", required_argument, NULL, 'A'},
+        {"csv-to-trace", required_argument, NULL, 'C'},
+        {"save-ops",  required_argument, NULL, 'O'},
+        {"replay-ops", required_argument, NULL, 'Y'},
+        {"perf",      no_argument,       NULL, 'P'},
+        {"perf-raw",  required_argument, NULL, 'W'},
+        {"help",     no_argument,       NULL, 'h'},
+        {NULL, 0, NULL, 0}
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+        case 'i': impl_name = optarg; break;
+        case 't': ths = parse_positive("threads", optarg); break;
+        case 'e': total_elements = parse_positive("elements", optarg); break;
+        case 's': consulta = parse_positive("searches", optarg); break;
+        case 'm': mix = optarg; break;
+        case 'k': w.key_range = parse_positive("key-range", optarg); break;
+        case 'n': w.initial = parse_nonnegative("initial", optarg); initial_set = 1; break;
+        case 'o': w.ops = parse_positive("ops", optarg); break;
+        case 'r': w.seed = (uint64_t)parse_nonnegative("seed", optarg); break;
+        case 'v': simd = optarg; break;
+        case 'b': scan_bench = 1; break;
+        case 'p': pin = optarg; break;
+        case 'u': numa_node = parse_nonnegative("numa-node", optarg); break;
+        case 'S': sweep_mode = 1; break;
+        case 'T': sweep.max_threads = parse_positive("max-threads", optarg); break;
+        case 'Z':
+            if (parse_sizes(optarg, &sweep) != 0) {
+                fprintf(stderr, "Valor inválido para --sizes: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'R': sweep.trials = parse_positive("trials", optarg); break;
+        case 'F': sweep.format = optarg; break;
+        case 'B': batch_size = parse_nonnegative("batch", optarg); break;
+        case 'K': {
+            int stripes = parse_positive("stripes", optarg);
+            if (stripes > LIST_MAX_STRIPES) {
+                fprintf(stderr, "Valor inválido para --stripes: %s (máximo %d)\n",
+                        optarg, LIST_MAX_STRIPES);
+                exit(EXIT_FAILURE);
+            }
+            list_set_stripes(stripes);
+            break;
+        }
+        case 'D':
+            if (workload_parse_dist(optarg, &w) != 0) {
+                fprintf(stderr, "Distribución inválida: %s "
+                                "(uniform, zipf[:S], hotspot[:K/O] o sequential)\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'H': {
+            char* end;
+            double rate = strtod(optarg, &end);
+            if (*optarg == '\0' || *end != '\0' || rate < 0.0 || rate > 100.0) {
+                fprintf(stderr, "Valor inválido para --hit-rate: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            w.hit_rate = rate / 100.0;
+            break;
+        }
+        case 'j':
+            if (workers_parse_handoff(optarg, &handoff) != 0) {
+                fprintf(stderr, "Valor inválido para --handoff: %s (futex o spin)\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'g': drain = 1; break;
+        case 'd': duration_ns = parse_duration("duration", optarg); break;
+        case 'w': warmup_ns = parse_duration("warmup", optarg); break;
+        case 'X': trace_path = optarg; break;
+        case 'A':
+            if (strcmp(optarg, "asap") != 0 && strcmp(optarg, "recorded") != 0) {
+                fprintf(stderr, "Valor inválido para --trace-pace: %s (asap o recorded)\n", optarg);
+                return EXIT_FAILURE;
+            }
+            trace_paced = strcmp(optarg, "recorded") == 0;
+            break;
+        case 'C': csv_path = optarg; break;
+        case 'O': save_ops_path = optarg; break;
+        case 'Y': replay_path = optarg; break;
+        case 'P': perf = 1; break;
+        case 'W': {
+            char* end;
+            perf_raw = strtoull(optarg, &end, 0);
+            if (*optarg == '\0' || *end != '\0' || perf_raw == 0) {
+                fprintf(stderr, "Valor inválido para --perf-raw: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            perf = 1;
+            break;
+        }
+        case 'h': usage(argv[0]); return EXIT_SUCCESS;
+        default:  usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+
+    if (simd_select(simd) != 0) {
+        fprintf(stderr, "Versión de --simd no disponible: %s\n", simd);
+        return EXIT_FAILURE;
+    }
+
+    if (placement_setup(pin, numa_node) != 0) {
+        fprintf(stderr, "Ubicación inválida: --pin=%s", pin);
+        if (numa_node >= 0)
+            fprintf(stderr, " --numa-node=%d", numa_node);
+        fprintf(stderr, "\n");
+        return EXIT_FAILURE;
+    }
+
+    if (perf && perf_setup(perf_raw) != 0)
+        fprintf(stderr, "perf_event_open no disponible (ver /proc/sys/kernel/perf_event_paranoid); "
+                        "se sigue sin contadores\n");
+
+    if (warmup_ns > 0 && duration_ns == 0) {
+        fprintf(stderr, "--warmup necesita --duration\n");
+        return EXIT_FAILURE;
+    }
+
+    if (csv_path != NULL) {
+        if (trace_path == NULL) {
+            fprintf(stderr, "--csv-to-trace necesita --trace=ARCHIVO de salida\n");
+            return EXIT_FAILURE;
+        }
+        return trace_convert_csv(csv_path, trace_path) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (scan_bench) {
+        run_scan_benchmark(total_elements, consulta, w.seed);
+        return 0;
+    }
+
+    if (impl_name == NULL) {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // El barrido siempre usa la carga mixta
+    if (sweep_mode && mix == NULL)
+        mix = "80/10/10";
+
+    if (mix != NULL) {
+        if (workload_parse_mix(mix, &w) != 0) {
+            fprintf(stderr, "Mezcla inválida: %s (se espera M/I/D sumando 100)\n", mix);
+            return EXIT_FAILURE;
+        }
+        if (w.key_range == 0)
+            w.key_range = w.initial > 0 ? 2 * w.initial : 1;
+        if (w.initial > w.key_range) {
+            fprintf(stderr, "--initial no puede ser mayor que --key-range\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (trace_path != NULL) {
+        if (mix != NULL || sweep_mode || save_ops_path != NULL || replay_path != NULL) {
+            fprintf(stderr, "--trace no se combina con --mix, --sweep, --save-ops ni --replay-ops\n");
+            return EXIT_FAILURE;
+        }
+        if (trace_open(trace_path, &trace) != 0) {
+            fprintf(stderr, "Traza inválida: %s\n", trace_path);
+            return EXIT_FAILURE;
+        }
+        if (w.key_range == 0)
+            w.key_range = trace.header->max_key + 1;
+        if (!initial_set)
+            w.initial = 0;
+        if (w.initial > w.key_range) {
+            fprintf(stderr, "--initial no puede ser mayor que --key-range\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (save_ops_path != NULL || replay_path != NULL) {
+        if (mix == NULL || sweep_mode || (save_ops_path != NULL && replay_path != NULL)) {
+            fprintf(stderr, "--save-ops y --replay-ops van por separado, con --mix y sin --sweep\n");
+            return EXIT_FAILURE;
+        }
+    }
+    if (replay_path != NULL) {
+        if (op_file_open(replay_path, &replay_ops) != 0) {
+            fprintf(stderr, "Archivo de operaciones inválido: %s\n", replay_path);
+            return EXIT_FAILURE;
+        }
+        if (replay_ops.threads != ths) {
+            fprintf(stderr, "%s tiene flujos para %d hilos (--threads=%d)\n",
+                    replay_path, replay_ops.threads, ths);
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Implementaciones a medir: "all" o una lista separada por comas.
+    // Todas se miden con los mismos parámetros.
+    const struct list_impl* selected[64];
+    int num_selected = 0;
+    if (strcmp(impl_name, "all") == 0) {
+        while (num_selected < 64 && (selected[num_selected] = list_impl_at(num_selected)) != NULL)
+            num_selected++;
+    } else {
+        char names[256];
+        snprintf(names, sizeof(names), "%s", impl_name);
+        for (char* name = strtok(names, ","); name != NULL; name = strtok(NULL, ",")) {
+            const struct list_impl* found = list_find_impl(name);
+            if (found == NULL || num_selected == 64) {
+                fprintf(stderr, "Implementación desconocida: %s\n", name);
+                usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            selected[num_selected++] = found;
+        }
+    }
+
+    if (sweep_mode) {
+        if (strcmp(sweep.format, "text") != 0 && strcmp(sweep.format, "csv") != 0 &&
+            strcmp(sweep.format, "json") != 0) {
+            fprintf(stderr, "Formato desconocido: %s (text, csv o json)\n", sweep.format);
+            return EXIT_FAILURE;
+        }
+        if (sweep.max_threads == 0)
+            sweep.max_threads = ths;
+        if (sweep.num_sizes == 0) {
+            sweep.sizes[0] = w.initial;
+            sweep.num_sizes = 1;
+        }
+        sweep.mix = mix;
+        // La salida estándar queda sólo para los resultados
+        placement_report(stderr, sweep.max_threads);
+        run_sweep(selected, num_selected, &sweep, &w);
+        return 0;
+    }
+
+    placement_report(stdout, ths);
+    for (int i = 0; i < num_selected; i++) {
+        impl = selected[i];
+        if (mix != NULL || trace.map != NULL)
+            run_mixed(ths, &w, 1);
+        else
+            run_benchmark(ths, total_elements, consulta, &w);
+    }
+    op_file_close(&replay_ops);
+    trace_close(&trace);
+    return 0;
+}
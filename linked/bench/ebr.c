@@ -0,0 +1,201 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para el mutex de los nodos huérfanos
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "ebr.h"
+
+// Cada cuántos retiros se intenta avanzar la época global
+#define EBR_ADVANCE_EVERY 64
+
+// Objeto retirado pendiente de liberar
+struct ebr_retired {
+    void* ptr;
+    void (*free_fn)(void*);
+};
+
+// Objetos retirados durante una misma época
+struct ebr_limbo {
+    unsigned long epoch;        // Época en la que se retiraron
+    struct ebr_retired* items;
+    size_t count;
+    size_t capacity;
+};
+
+// Estado de un hilo registrado, en su propia línea de caché
+struct ebr_record {
+    // (época << 1) | 1 mientras el hilo está en una sección crítica, 0 si no
+    _Atomic unsigned long local;
+    atomic_int in_use;
+    struct ebr_limbo limbo[3];
+    unsigned retired_since_advance;
+} __attribute__((aligned(64)));
+
+static _Atomic unsigned long global_epoch = 2;
+static struct ebr_record records[EBR_MAX_THREADS];
+static atomic_int max_records = 0;  // Registros usados alguna vez
+
+// Registro del hilo actual
+static __thread struct ebr_record* self = NULL;
+
+// Objetos retirados por hilos que ya terminaron
+static pthread_mutex_t orphans_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct ebr_limbo orphans[3];
+
+// Liberar todos los objetos de un limbo
+static void limbo_free(struct ebr_limbo* limbo) {
+    for (size_t i = 0; i < limbo->count; i++) {
+        limbo->items[i].free_fn(limbo->items[i].ptr);
+    }
+    limbo->count = 0;
+}
+
+// Agregar un objeto a un limbo
+static void limbo_push(struct ebr_limbo* limbo, void* ptr, void (*free_fn)(void*)) {
+    if (limbo->count == limbo->capacity) {
+        size_t capacity = limbo->capacity ? 2 * limbo->capacity : 64;
+        struct ebr_retired* items = realloc(limbo->items, capacity * sizeof(*items));
+        if (items == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            exit(EXIT_FAILURE);
+        }
+        limbo->items = items;
+        limbo->capacity = capacity;
+    }
+    limbo->items[limbo->count].ptr = ptr;
+    limbo->items[limbo->count].free_fn = free_fn;
+    limbo->count++;
+}
+
+// Liberar los limbos retirados al menos dos épocas antes de `epoch`
+static void limbo_collect(struct ebr_limbo limbo[3], unsigned long epoch) {
+    for (int i = 0; i < 3; i++) {
+        if (limbo[i].count > 0 && limbo[i].epoch + 2 <= epoch)
+            limbo_free(&limbo[i]);
+    }
+}
+
+// Avanzar la época global si todos los hilos activos ya la observaron
+static void try_advance(void) {
+    unsigned long epoch = atomic_load(&global_epoch);
+    int n = atomic_load(&max_records);
+
+    for (int i = 0; i < n; i++) {
+        unsigned long local = atomic_load(&records[i].local);
+        if ((local & 1) && (local >> 1) != epoch)
+            return; // Un hilo sigue en una época anterior
+    }
+
+    if (atomic_compare_exchange_strong(&global_epoch, &epoch, epoch + 1))
+        epoch++;
+
+    // Liberar lo propio que ya quedó dos épocas atrás
+    limbo_collect(self->limbo, epoch);
+
+    // Aprovechar para liberar lo que dejaron los hilos que terminaron
+    if (pthread_mutex_trylock(&orphans_mutex) == 0) {
+        limbo_collect(orphans, epoch);
+        pthread_mutex_unlock(&orphans_mutex);
+    }
+}
+
+// Registrar el hilo actual
+void ebr_thread_init(void) {
+    if (self != NULL)
+        return;
+
+    for (int i = 0; i < EBR_MAX_THREADS; i++) {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&records[i].in_use, &expected, 1)) {
+            self = &records[i];
+            atomic_store(&self->local, 0);
+            int n = atomic_load(&max_records);
+            while (n < i + 1 && !atomic_compare_exchange_weak(&max_records, &n, i + 1))
+                ;
+            return;
+        }
+    }
+
+    fprintf(stderr, "ebr: más de %d hilos registrados\n", EBR_MAX_THREADS);
+    exit(EXIT_FAILURE);
+}
+
+// Dar de baja el hilo actual: lo pendiente pasa a la lista de huérfanos
+void ebr_thread_exit(void) {
+    if (self == NULL)
+        return;
+
+    pthread_mutex_lock(&orphans_mutex);
+    for (int i = 0; i < 3; i++) {
+        struct ebr_limbo* limbo = &self->limbo[i];
+        if (limbo->count == 0)
+            continue;
+        // Se agrupa por la época de retiro para no liberar antes de tiempo.
+        // Dos épocas del mismo grupo difieren en al menos tres: la más vieja ya se puede liberar.
+        struct ebr_limbo* orphan = &orphans[limbo->epoch % 3];
+        if (orphan->count > 0 && orphan->epoch > limbo->epoch) {
+            limbo_free(limbo);
+            continue;
+        }
+        if (orphan->count > 0 && orphan->epoch < limbo->epoch)
+            limbo_free(orphan);
+        orphan->epoch = limbo->epoch;
+        for (size_t j = 0; j < limbo->count; j++) {
+            limbo_push(orphan, limbo->items[j].ptr, limbo->items[j].free_fn);
+        }
+        limbo->count = 0;
+    }
+    pthread_mutex_unlock(&orphans_mutex);
+
+    atomic_store(&self->local, 0);
+    atomic_store(&self->in_use, 0);
+    self = NULL;
+}
+
+// Entrar a una sección crítica: sólo anunciar la época observada. No libera
+// nada, así una lectura nunca paga la recolección ni toma el mutex del pool;
+// lo retirado se libera en ebr_retire.
+void ebr_enter(void) {
+    unsigned long epoch = atomic_load_explicit(&global_epoch, memory_order_relaxed);
+    // Seq_cst: el anuncio debe ser visible antes de leer cualquier puntero compartido
+    atomic_store(&self->local, (epoch << 1) | 1);
+}
+
+// Salir de la sección crítica
+void ebr_exit(void) {
+    atomic_store_explicit(&self->local, 0, memory_order_release);
+}
+
+// Retirar un objeto ya desenlazado
+void ebr_retire(void* ptr, void (*free_fn)(void*)) {
+    // Se usa la época global actual y no la anunciada por este hilo: otro
+    // hilo pudo entrar en la siguiente época y todavía ver el nodo
+    unsigned long epoch = atomic_load(&global_epoch);
+    struct ebr_limbo* limbo = &self->limbo[epoch % 3];
+
+    if (limbo->count > 0 && limbo->epoch != epoch)
+        limbo_free(limbo); // Retirado tres épocas antes: ya es seguro
+    limbo->epoch = epoch;
+    limbo_push(limbo, ptr, free_fn);
+
+    if (++self->retired_since_advance >= EBR_ADVANCE_EVERY) {
+        self->retired_since_advance = 0;
+        try_advance();
+    }
+}
+
+// Liberar todo lo pendiente (ningún hilo debe estar en una sección crítica)
+void ebr_drain(void) {
+    int n = atomic_load(&max_records);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < 3; j++) {
+            limbo_free(&records[i].limbo[j]);
+        }
+    }
+
+    pthread_mutex_lock(&orphans_mutex);
+    for (int j = 0; j < 3; j++) {
+        limbo_free(&orphans[j]);
+    }
+    pthread_mutex_unlock(&orphans_mutex);
+}
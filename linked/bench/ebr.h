@@ -0,0 +1,35 @@
+#ifndef EBR_H
+#define EBR_H
+
+// Recolección de memoria basada en épocas (epoch-based reclamation).
+//
+// Los lectores marcan el inicio y el fin de cada operación con ebr_enter y
+// ebr_exit. Un nodo desenlazado se entrega a ebr_retire y sólo se libera
+// cuando la época global avanzó dos veces desde entonces: para ese momento
+// ningún hilo que pudiera tener un puntero al nodo sigue dentro de su operación.
+// La liberación la hace el hilo que retira, dentro de ebr_retire: ebr_enter y
+// ebr_exit sólo escriben en el registro del propio hilo, nunca liberan ni
+// toman locks, así que una búsqueda que sólo lee no espera a nadie.
+//
+// Cada hilo que use una estructura protegida debe llamar a ebr_thread_init
+// antes de su primera operación y a ebr_thread_exit al terminar.
+
+#define EBR_MAX_THREADS 256
+
+// Registrar / dar de baja el hilo actual
+void ebr_thread_init(void);
+void ebr_thread_exit(void);
+
+// Delimitar una sección crítica de lectura
+void ebr_enter(void);
+void ebr_exit(void);
+
+// Liberar `ptr` con `free_fn` cuando ningún hilo pueda estar usándolo.
+// Debe llamarse dentro de una sección crítica.
+void ebr_retire(void* ptr, void (*free_fn)(void*));
+
+// Liberar todo lo pendiente. Sólo es seguro cuando ningún hilo está
+// dentro de una sección crítica (p. ej. al destruir la lista).
+void ebr_drain(void);
+
+#endif
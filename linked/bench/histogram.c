@@ -0,0 +1,51 @@
+#include <string.h>     // Para memset
+
+#include "histogram.h"
+
+// Vaciar el histograma
+void hist_reset(struct histogram* h) {
+    memset(h, 0, sizeof(*h));
+}
+
+// Sumar las muestras de `src` a `dst`
+void hist_merge(struct histogram* dst, const struct histogram* src) {
+    dst->count += src->count;
+    dst->sum += src->sum;
+    if (src->max > dst->max)
+        dst->max = src->max;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        dst->buckets[i] += src->buckets[i];
+    }
+}
+
+// Mayor valor que cae en el intervalo `index`
+static uint64_t bucket_upper(int index) {
+    if (index < HIST_SUB_COUNT)
+        return (uint64_t)index;
+    int shift = index / HIST_SUB_COUNT - 1;
+    uint64_t sub = (uint64_t)(index % HIST_SUB_COUNT);
+    return ((HIST_SUB_COUNT + sub + 1) << shift) - 1;
+}
+
+// Valor del percentil `p` (0-100)
+uint64_t hist_percentile(const struct histogram* h, double p) {
+    if (h->count == 0)
+        return 0;
+
+    // Rango de la muestra buscada (1..count)
+    uint64_t rank = (uint64_t)(p / 100.0 * (double)h->count + 0.5);
+    if (rank < 1)
+        rank = 1;
+    if (rank > h->count)
+        rank = h->count;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            uint64_t upper = bucket_upper(i);
+            return upper < h->max ? upper : h->max;
+        }
+    }
+    return h->max;
+}
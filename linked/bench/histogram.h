@@ -0,0 +1,56 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <stdint.h>     // Para uint64_t
+#include <time.h>       // Para clock_gettime
+
+// Histograma de latencias log-lineal: cada potencia de dos se divide en
+// 2^HIST_SUB_BITS subintervalos, así el error relativo es menor al 6.25 %
+// sin importar la escala. Cada hilo registra en el suyo y se mezclan al final.
+
+#define HIST_SUB_BITS 4
+#define HIST_SUB_COUNT (1 << HIST_SUB_BITS)
+#define HIST_BUCKETS (64 * HIST_SUB_COUNT)
+
+struct histogram {
+    uint64_t count;                 // Número de muestras
+    uint64_t sum;                   // Suma de las muestras (para la media)
+    uint64_t max;                   // Muestra más grande
+    uint64_t buckets[HIST_BUCKETS];
+};
+
+// Tiempo de reloj de pared en nanosegundos
+static inline uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Índice del intervalo que contiene `value`
+static inline int hist_bucket(uint64_t value) {
+    if (value < HIST_SUB_COUNT)
+        return (int)value;
+    int msb = 63 - __builtin_clzll(value);
+    int shift = msb - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB_COUNT + (int)((value >> shift) & (HIST_SUB_COUNT - 1));
+}
+
+// Registrar una muestra
+static inline void hist_record(struct histogram* h, uint64_t value) {
+    h->count++;
+    h->sum += value;
+    if (value > h->max)
+        h->max = value;
+    h->buckets[hist_bucket(value)]++;
+}
+
+// Vaciar el histograma
+void hist_reset(struct histogram* h);
+
+// Sumar las muestras de `src` a `dst`
+void hist_merge(struct histogram* dst, const struct histogram* src);
+
+// Valor del percentil `p` (0-100), como cota superior de su intervalo
+uint64_t hist_percentile(const struct histogram* h, double p);
+
+#endif
@@ -0,0 +1,96 @@
+#include <string.h>     // Para strcmp
+
+#include "list.h"
+
+// Registro de todos los backends, en el orden en que se listan en --help
+static const struct list_impl* const impls[] = {
+    &list_one_entire,
+    &list_global_ttas,
+    &list_global_ticket,
+    &list_global_mcs,
+    &list_global_clh,
+    &list_striped,
+    &list_rwl,
+    &list_rwl_writer,
+    &list_rwl_biased,
+    &list_rwl_pf,
+    &list_seqlock,
+    &list_rcu,
+    &list_fc,
+    &list_one_mutex,
+    &list_hoh_spin,
+    &list_lockfree,
+    &list_lazy,
+    &list_skiplist,
+    &list_unrolled,
+    &list_unrolled_rw,
+    &list_unrolled_hoh,
+};
+
+static const int num_impls = sizeof(impls) / sizeof(impls[0]);
+
+int list_stripes = 16;
+int list_key_range = 1000;
+
+void list_set_stripes(int stripes) {
+    list_stripes = stripes > 0 ? stripes : 1;
+}
+
+void list_set_key_range(int key_range) {
+    list_key_range = key_range > 0 ? key_range : 1;
+}
+
+// Aplicar `op` clave por clave (backends sin versión por lotes)
+static int ApplyEach(int (*op)(int), const int* values, int n, int* results) {
+    int hits = 0;
+    for (int i = 0; i < n; i++) {
+        int result = op(values[i]);
+        if (results != NULL)
+            results[i] = result;
+        if (result < 0)
+            return -1;
+        hits += (result == 1);
+    }
+    return hits;
+}
+
+int list_insert_batch(const struct list_impl* impl, const int* values, int n, int* results) {
+    if (impl->InsertBatch != NULL)
+        return impl->InsertBatch(values, n, results);
+    return ApplyEach(impl->Insert, values, n, results);
+}
+
+int list_member_batch(const struct list_impl* impl, const int* values, int n, int* results) {
+    if (impl->MemberBatch != NULL)
+        return impl->MemberBatch(values, n, results);
+    return ApplyEach(impl->Member, values, n, results);
+}
+
+int list_delete_batch(const struct list_impl* impl, const int* values, int n, int* results) {
+    if (impl->DeleteBatch != NULL)
+        return impl->DeleteBatch(values, n, results);
+    return ApplyEach(impl->Delete, values, n, results);
+}
+
+// Buscar un backend por nombre
+const struct list_impl* list_find_impl(const char* name) {
+    for (int i = 0; i < num_impls; i++) {
+        if (strcmp(impls[i]->name, name) == 0)
+            return impls[i];
+    }
+    return NULL;
+}
+
+// Backend número i del registro
+const struct list_impl* list_impl_at(int i) {
+    if (i < 0 || i >= num_impls)
+        return NULL;
+    return impls[i];
+}
+
+// Imprimir los backends disponibles
+void list_print_impls(FILE* out) {
+    for (int i = 0; i < num_impls; i++) {
+        fprintf(out, "  %-13s %s\n", impls[i]->name, impls[i]->description);
+    }
+}
@@ -0,0 +1,81 @@
+#ifndef LIST_H
+#define LIST_H
+
+#include <stdio.h>      // Para FILE
+
+// Interfaz común de las implementaciones de la lista enlazada ordenada.
+// Cada backend (mutex global, read-write lock, mutex por nodo, ...) expone
+// las mismas operaciones para que el benchmark las mida de la misma forma.
+struct list_impl {
+    const char* name;         // Nombre usado en --impl
+    const char* description;  // Descripción corta para --help
+    void (*init)(void);       // Crear la lista vacía y sus locks
+    void (*destroy)(void);    // Liberar todos los nodos y los locks
+    void (*thread_init)(void); // Opcional: al empezar cada hilo de trabajo
+    void (*thread_exit)(void); // Opcional: al terminar cada hilo de trabajo
+    int (*Insert)(int value); // 1 si se insertó, 0 si ya existía, -1 si falló la memoria
+    int (*Member)(int value); // 1 si está en la lista, 0 si no
+    int (*Delete)(int value); // 1 si se eliminó, 0 si no estaba
+
+    // Opcional: operaciones por lotes. `values` está ordenado de menor a
+    // mayor (puede repetir claves) y se aplica en una sola pasada sobre la
+    // lista. Si `results` no es NULL recibe el resultado de cada clave, como
+    // lo devolvería la operación individual. Devuelven cuántas claves dieron
+    // 1 (InsertBatch: -1 si falló la memoria).
+    int (*InsertBatch)(const int* values, int n, int* results);
+    int (*MemberBatch)(const int* values, int n, int* results);
+    int (*DeleteBatch)(const int* values, int n, int* results);
+
+    // Opcional: llamar a fn con cada clave de la lista, de menor a mayor.
+    // fn no debe operar sobre la lista.
+    void (*ForEach)(void (*fn)(int value, void* arg), void* arg);
+};
+
+// Backends disponibles
+extern const struct list_impl list_one_entire;     // --impl=global
+extern const struct list_impl list_global_ttas;    // --impl=global-ttas
+extern const struct list_impl list_global_ticket;  // --impl=global-ticket
+extern const struct list_impl list_global_mcs;     // --impl=global-mcs
+extern const struct list_impl list_global_clh;     // --impl=global-clh
+extern const struct list_impl list_striped;        // --impl=striped
+extern const struct list_impl list_rwl;            // --impl=rwlock
+extern const struct list_impl list_rwl_writer;     // --impl=rwlock-writer
+extern const struct list_impl list_rwl_biased;     // --impl=rwlock-biased
+extern const struct list_impl list_rwl_pf;         // --impl=rwlock-pf
+extern const struct list_impl list_seqlock;        // --impl=seqlock
+extern const struct list_impl list_rcu;            // --impl=rcu
+extern const struct list_impl list_fc;             // --impl=fc
+extern const struct list_impl list_one_mutex;      // --impl=hoh
+extern const struct list_impl list_hoh_spin;       // --impl=hoh-spin
+extern const struct list_impl list_lockfree;       // --impl=lockfree
+extern const struct list_impl list_lazy;           // --impl=lazy
+extern const struct list_impl list_skiplist;       // --impl=skiplist
+extern const struct list_impl list_unrolled;       // --impl=unrolled
+extern const struct list_impl list_unrolled_rw;    // --impl=unrolled-rw
+extern const struct list_impl list_unrolled_hoh;   // --impl=unrolled-hoh
+
+// Backends por franjas: cantidad de franjas (--stripes) y rango de claves
+// esperado [0, key_range) que se reparte entre ellas. Se leen en init().
+// Como mucho LIST_MAX_STRIPES franjas.
+#define LIST_MAX_STRIPES 1024
+extern int list_stripes;
+extern int list_key_range;
+void list_set_stripes(int stripes);
+void list_set_key_range(int key_range);
+
+// Operaciones por lotes sobre cualquier backend: usan la versión por lotes
+// si el backend la tiene y, si no, aplican las claves una por una
+int list_insert_batch(const struct list_impl* impl, const int* values, int n, int* results);
+int list_member_batch(const struct list_impl* impl, const int* values, int n, int* results);
+int list_delete_batch(const struct list_impl* impl, const int* values, int n, int* results);
+
+// Buscar un backend por nombre (NULL si no existe)
+const struct list_impl* list_find_impl(const char* name);
+
+// Backend número i del registro (NULL al pasar el último)
+const struct list_impl* list_impl_at(int i);
+
+// Imprimir la lista de backends disponibles
+void list_print_impls(FILE* out);
+
+#endif
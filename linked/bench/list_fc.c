@@ -0,0 +1,256 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "list.h"
+#include "pool.h"
+#include "spin.h"
+#include "stats.h"
+
+// Backend con combinación plana (flat combining). Cada hilo publica su
+// operación en una ranura propia (en su propia línea de caché) y espera.
+// El hilo que consigue el lock de combinador junta todas las ranuras
+// pendientes, las ordena por clave y las aplica en una sola pasada sobre la
+// lista; después publica cada resultado en su ranura. La lista sólo la toca
+// el combinador, así que no necesita otra sincronización, y el lock pasa
+// de un núcleo a otro una vez por ronda en lugar de una vez por operación.
+//
+// Los nodos se reservan y se liberan en el hilo que pidió la operación,
+// fuera de la combinación: Insert deja un nodo en su ranura y Delete recibe
+// el nodo desenlazado.
+
+#define FC_MAX_THREADS 256
+#define FC_ROUNDS 2             // Rondas por turno de combinador
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;
+    struct list_node_s* next;
+};
+
+enum { SLOT_IDLE, SLOT_PENDING, SLOT_DONE };
+enum { FC_MEMBER, FC_INSERT, FC_DELETE };
+
+// Ranura de un hilo
+struct fc_slot {
+    atomic_int state;           // SLOT_IDLE, SLOT_PENDING o SLOT_DONE
+    int op;                     // FC_MEMBER, FC_INSERT o FC_DELETE
+    int value;
+    int result;
+    struct list_node_s* node;   // Insert: nodo a usar (vuelve si sobró); Delete: nodo borrado
+    atomic_int in_use;
+} __attribute__((aligned(64)));
+
+// Operación pendiente tomada por el combinador
+struct fc_request {
+    int value;
+    int slot;
+};
+
+static struct list_node_s* head_p = NULL;
+static struct node_pool* node_pool; // Nodos reservados fuera de la combinación
+static atomic_int combiner_lock;    // 1 mientras un hilo combina
+
+static struct fc_slot slots[FC_MAX_THREADS];
+static atomic_int max_slots = 0;    // Ranuras usadas alguna vez
+static __thread struct fc_slot* self = NULL;
+
+// Sólo las usa el combinador
+static struct fc_request requests[FC_MAX_THREADS];
+
+// Registrar el hilo actual
+static void ThreadInit(void) {
+    if (self != NULL)
+        return;
+
+    for (int i = 0; i < FC_MAX_THREADS; i++) {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&slots[i].in_use, &expected, 1)) {
+            self = &slots[i];
+            atomic_store(&self->state, SLOT_IDLE);
+            int n = atomic_load(&max_slots);
+            while (n < i + 1 && !atomic_compare_exchange_weak(&max_slots, &n, i + 1))
+                ;
+            return;
+        }
+    }
+
+    fprintf(stderr, "fc: más de %d hilos registrados\n", FC_MAX_THREADS);
+    exit(EXIT_FAILURE);
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+    if (self != NULL) {
+        atomic_store(&self->in_use, 0);
+        self = NULL;
+    }
+    pool_thread_exit();
+}
+
+// Ordenar por clave; a igual clave, por ranura
+static int CompareRequests(const void* a, const void* b) {
+    const struct fc_request* x = (const struct fc_request*)a;
+    const struct fc_request* y = (const struct fc_request*)b;
+    if (x->value != y->value)
+        return (x->value > y->value) - (x->value < y->value);
+    return x->slot - y->slot;
+}
+
+// Aplicar las operaciones pendientes en una sola pasada. Devuelve cuántas aplicó.
+static int Combine(void) {
+    int n = atomic_load(&max_slots);
+    int count = 0;
+
+    for (int i = 0; i < n; i++) {
+        if (atomic_load_explicit(&slots[i].state, memory_order_acquire) == SLOT_PENDING) {
+            requests[count].value = slots[i].value;
+            requests[count].slot = i;
+            count++;
+        }
+    }
+    if (count == 0)
+        return 0;
+    if (count > 1)
+        qsort(requests, count, sizeof(struct fc_request), CompareRequests);
+
+    // Misma pasada que las operaciones por lotes: cada clave sigue desde
+    // donde quedó la anterior
+    struct list_node_s* curr_p = head_p;
+    struct list_node_s* pred_p = NULL;
+    for (int r = 0; r < count; r++) {
+        struct fc_slot* slot = &slots[requests[r].slot];
+        int value = requests[r].value;
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT(); // Los cuenta el combinador, por todo el lote
+            pred_p = curr_p;
+            curr_p = curr_p->next;
+        }
+        int present = curr_p != NULL && curr_p->data == value;
+
+        switch (slot->op) {
+        case FC_MEMBER:
+            slot->result = present;
+            break;
+        case FC_INSERT:
+            slot->result = !present;
+            if (!present) {
+                struct list_node_s* temp_p = slot->node;
+                slot->node = NULL; // El nodo queda en la lista
+                temp_p->data = value;
+                temp_p->next = curr_p;
+                if (pred_p == NULL) {
+                    head_p = temp_p;
+                } else {
+                    pred_p->next = temp_p;
+                }
+                curr_p = temp_p; // Primer nodo con data >= value
+            }
+            break;
+        default:
+            slot->result = present;
+            if (present) {
+                struct list_node_s* next_p = curr_p->next;
+                if (pred_p == NULL) {
+                    head_p = next_p;
+                } else {
+                    pred_p->next = next_p; // Bypass the current node
+                }
+                slot->node = curr_p; // Lo libera el hilo que pidió el borrado
+                curr_p = next_p;
+            }
+            break;
+        }
+        atomic_store_explicit(&slot->state, SLOT_DONE, memory_order_release);
+    }
+    return count;
+}
+
+// Publicar una operación y esperar su resultado, combinando si hace falta
+static int Execute(int op, int value) {
+    self->op = op;
+    self->value = value;
+    atomic_store_explicit(&self->state, SLOT_PENDING, memory_order_release);
+
+    unsigned spins = 0;
+    uint64_t wait_start = STATS_WAIT_START();
+    for (;;) {
+        if (atomic_load_explicit(&self->state, memory_order_acquire) == SLOT_DONE)
+            break;
+        // Test-and-test-and-set: sólo intentar tomar el lock si parece libre
+        if (atomic_load_explicit(&combiner_lock, memory_order_relaxed) == 0 &&
+            atomic_exchange_explicit(&combiner_lock, 1, memory_order_acquire) == 0) {
+            STATS_LOCKED(&combiner_lock, wait_start, spins != 0);
+            for (int round = 0; round < FC_ROUNDS; round++) {
+                if (Combine() == 0)
+                    break;
+            }
+            STATS_UNLOCK(&combiner_lock,
+                         atomic_store_explicit(&combiner_lock, 0, memory_order_release));
+            // La propia operación ya fue aplicada (estaba pendiente al combinar)
+            continue;
+        }
+        spin_relax(&spins);
+    }
+
+    atomic_store_explicit(&self->state, SLOT_IDLE, memory_order_relaxed);
+    return self->result;
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    self->node = NULL;
+    int result = Execute(FC_DELETE, value);
+    if (self->node != NULL) {
+        pool_free(node_pool, self->node); // Free the memory of the deleted node
+        self->node = NULL;
+    }
+    return result;
+}
+
+// Función para verificar si un elemento es miembro de la lista
+static int Member(int value) {
+    return Execute(FC_MEMBER, value);
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    // Reservar el nodo antes de publicar la operación
+    self->node = (struct list_node_s*)pool_alloc(node_pool);
+    if (self->node == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+
+    int result = Execute(FC_INSERT, value);
+    if (self->node != NULL) {
+        pool_free(node_pool, self->node); // El valor ya estaba: el nodo sobró
+        self->node = NULL;
+    }
+    return result;
+}
+
+// Inicialización de la lista vacía
+static void Init(void) {
+    head_p = NULL;
+    atomic_init(&combiner_lock, 0);
+    node_pool = pool_create(sizeof(struct list_node_s));
+}
+
+// Limpiar la memoria de la lista enlazada
+static void Destroy(void) {
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    head_p = NULL;
+}
+
+const struct list_impl list_fc = {
+    .name = "fc",
+    .description = "combinación plana: un combinador aplica las operaciones pendientes ordenadas",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_init = ThreadInit,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
@@ -0,0 +1,18 @@
+// Lista con un único lock CLH (--impl=global-clh). Cada hilo espera sobre
+// el nodo de su predecesor en la cola.
+
+#include "locks.h"
+
+static __thread struct clh_handle clh_self;
+
+#define LOCK_TYPE struct clh_lock
+#define LOCK_INIT(l) clh_init(l)
+#define LOCK_DESTROY(l) clh_destroy(l)
+#define LOCK_ACQUIRE(l) clh_acquire((l), &clh_self)
+#define LOCK_RELEASE(l) clh_release(&clh_self)
+#define LOCK_THREAD_EXIT() clh_thread_exit(&clh_self)
+#define IMPL_SYMBOL list_global_clh
+#define IMPL_NAME "global-clh"
+#define IMPL_DESCRIPTION "un lock de cola CLH para toda la lista"
+
+#include "list_global_tmpl.h"
@@ -0,0 +1,17 @@
+// Lista con un único lock MCS (--impl=global-mcs). Cada hilo espera sobre
+// su propio nodo de la cola.
+
+#include "locks.h"
+
+static __thread struct mcs_node mcs_self;
+
+#define LOCK_TYPE struct mcs_lock
+#define LOCK_INIT(l) mcs_init(l)
+#define LOCK_DESTROY(l) ((void)(l))
+#define LOCK_ACQUIRE(l) mcs_acquire((l), &mcs_self)
+#define LOCK_RELEASE(l) mcs_release((l), &mcs_self)
+#define IMPL_SYMBOL list_global_mcs
+#define IMPL_NAME "global-mcs"
+#define IMPL_DESCRIPTION "un lock de cola MCS para toda la lista"
+
+#include "list_global_tmpl.h"
@@ -0,0 +1,14 @@
+// Lista con un único ticket lock (--impl=global-ticket)
+
+#include "locks.h"
+
+#define LOCK_TYPE struct ticket_lock
+#define LOCK_INIT(l) ticket_init(l)
+#define LOCK_DESTROY(l) ((void)(l))
+#define LOCK_ACQUIRE(l) ticket_acquire(l)
+#define LOCK_RELEASE(l) ticket_release(l)
+#define IMPL_SYMBOL list_global_ticket
+#define IMPL_NAME "global-ticket"
+#define IMPL_DESCRIPTION "un ticket lock (FIFO) para toda la lista"
+
+#include "list_global_tmpl.h"
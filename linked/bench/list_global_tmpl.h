@@ -0,0 +1,387 @@
+// Plantilla de la lista con un único lock para toda la lista
+// (linked/one_entire). Cada backend define el tipo de lock y después
+// incluye este archivo en su propia unidad de compilación:
+//
+//   LOCK_TYPE           tipo del lock
+//   LOCK_INIT(l)        inicializar el lock (l es un LOCK_TYPE*)
+//   LOCK_DESTROY(l)     destruirlo
+//   LOCK_ACQUIRE(l)     tomarlo; con LIST_STATS vale distinto de 0 si hubo
+//                       que esperar (sin ella el valor se descarta)
+//   LOCK_RELEASE(l)     soltarlo
+//   LOCK_THREAD_EXIT()  opcional: al terminar cada hilo de trabajo
+//   MAX_STRIPES         opcional: franjas máximas (por defecto 1, una sola lista)
+//   IMPL_SYMBOL         nombre del struct list_impl que se define
+//   IMPL_NAME           nombre usado en --impl
+//   IMPL_DESCRIPTION    descripción corta para --help
+
+// Con MAX_STRIPES > 1 el rango de claves se parte en franjas contiguas
+// (list_set_stripes, list_set_key_range), cada una con su propia lista y su
+// propio lock. Las franjas están en orden, así que recorrerlas una detrás
+// de otra da todas las claves ordenadas.
+
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+
+#include "list.h"
+#include "pool.h"
+#include "stats.h"
+
+// Tomar y soltar un lock pasando por la instrumentación (stats.h)
+#define Acquire(l) STATS_LOCK((l), LOCK_ACQUIRE(l))
+#define Release(l) STATS_UNLOCK((l), LOCK_RELEASE(l))
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;
+    struct list_node_s* next;
+};
+
+#ifndef MAX_STRIPES
+#define MAX_STRIPES 1
+#endif
+
+// Una franja: su lista y el lock que la protege, en su propia línea de caché
+struct list_stripe {
+    LOCK_TYPE lock;
+    struct list_node_s* head_p;
+} __attribute__((aligned(64)));
+
+static struct list_stripe stripes[MAX_STRIPES];
+static struct node_pool* node_pool; // Nodos reservados fuera de la sección crítica
+
+#if MAX_STRIPES > 1
+static int num_stripes = 1;
+static int stripe_width = 1;        // Claves por franja
+
+// Franja que contiene `value`; las claves fuera del rango van a la primera o a la última
+static inline struct list_stripe* StripeOf(int value) {
+    if (value < 0)
+        return &stripes[0];
+    int s = value / stripe_width;
+    return &stripes[s < num_stripes ? s : num_stripes - 1];
+}
+#else
+static const int num_stripes = 1;
+
+static inline struct list_stripe* StripeOf(int value) {
+    (void)value;
+    return &stripes[0];
+}
+#endif
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    struct list_stripe* list = StripeOf(value);
+    Acquire(&list->lock); // Bloquear la lista
+    struct list_node_s* curr_p = list->head_p;
+    struct list_node_s* pred_p = NULL;
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+    }
+
+    // Si se encontró el nodo a eliminar
+    if (curr_p != NULL && curr_p->data == value) {
+        if (pred_p == NULL) { // Deleting the first node
+            list->head_p = curr_p->next; // Update head pointer
+        } else {
+            pred_p->next = curr_p->next; // Bypass the current node
+        }
+        Release(&list->lock); // Desbloquear la lista
+        pool_free(node_pool, curr_p); // Free the memory of the deleted node
+        return 1; // Successful deletion
+    }
+
+    Release(&list->lock); // Desbloquear la lista
+    return 0; // Value not found in the list
+}
+
+// Función para verificar si un elemento es miembro de la lista
+static int Member(int value) {
+    struct list_stripe* list = StripeOf(value);
+    Acquire(&list->lock); // Bloquear la lista
+    struct list_node_s* temp_p = list->head_p;
+
+    while (temp_p != NULL && temp_p->data < value) {
+        STATS_VISIT();
+        temp_p = temp_p->next;
+    }
+
+    if (temp_p == NULL || temp_p->data > value) {
+        Release(&list->lock); // Desbloquear la lista
+        return 0; // No encontrado
+    } else {
+        Release(&list->lock); // Desbloquear la lista
+        return 1; // Encontrado
+    }
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    // Reservar el nodo antes de tomar el lock
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+
+    struct list_stripe* list = StripeOf(value);
+    Acquire(&list->lock); // Bloquear la lista
+    struct list_node_s* curr_p = list->head_p;
+    struct list_node_s* pred_p = NULL;
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+    }
+
+    // El valor ya está en la lista
+    if (curr_p != NULL && curr_p->data == value) {
+        Release(&list->lock); // Desbloquear la lista
+        pool_free(node_pool, temp_p);
+        return 0;
+    }
+
+    temp_p->next = curr_p;
+
+    // Insertar en la lista ordenada
+    if (pred_p == NULL) {
+        list->head_p = temp_p;
+    } else {
+        pred_p->next = temp_p;
+    }
+
+    Release(&list->lock); // Desbloquear la lista
+    return 1;
+}
+
+// Devolver al pool una cadena de nodos enlazados por next
+static void FreeNodes(struct list_node_s* chain) {
+    while (chain != NULL) {
+        struct list_node_s* next = chain->next;
+        pool_free(node_pool, chain);
+        chain = next;
+    }
+}
+
+// Reservar `n` nodos encadenados por next (NULL si falló la memoria)
+static struct list_node_s* AllocNodes(int n) {
+    struct list_node_s* chain = NULL;
+    for (int i = 0; i < n; i++) {
+        struct list_node_s* node = (struct list_node_s*)pool_alloc(node_pool);
+        if (node == NULL) {
+            FreeNodes(chain);
+            return NULL;
+        }
+        node->next = chain;
+        chain = node;
+    }
+    return chain;
+}
+
+// Insertar un tramo ordenado de una franja en una sola pasada con un solo lock
+static int InsertRun(struct list_stripe* list, const int* values, int n, int* results) {
+    // Reservar todos los nodos antes de tomar el lock
+    struct list_node_s* spare = AllocNodes(n);
+    if (spare == NULL && n > 0) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+
+    int inserted = 0;
+    Acquire(&list->lock); // Bloquear la lista
+    struct list_node_s* curr_p = list->head_p;
+    struct list_node_s* pred_p = NULL;
+
+    for (int i = 0; i < n; i++) {
+        int value = values[i];
+        // Las claves están ordenadas: se sigue desde donde quedó la anterior
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT();
+            pred_p = curr_p;
+            curr_p = curr_p->next;
+        }
+
+        // El valor ya está en la lista
+        if (curr_p != NULL && curr_p->data == value) {
+            if (results != NULL)
+                results[i] = 0;
+            continue;
+        }
+
+        struct list_node_s* temp_p = spare;
+        spare = spare->next;
+        temp_p->data = value;
+        temp_p->next = curr_p;
+        if (pred_p == NULL) {
+            list->head_p = temp_p;
+        } else {
+            pred_p->next = temp_p;
+        }
+        curr_p = temp_p; // Primer nodo con data >= value
+        inserted++;
+        if (results != NULL)
+            results[i] = 1;
+    }
+
+    Release(&list->lock); // Desbloquear la lista
+    FreeNodes(spare); // Los que sobraron por claves repetidas
+    return inserted;
+}
+
+// Buscar un tramo ordenado de una franja en una sola pasada
+static int MemberRun(struct list_stripe* list, const int* values, int n, int* results) {
+    int found = 0;
+    Acquire(&list->lock); // Bloquear la lista
+    struct list_node_s* temp_p = list->head_p;
+
+    for (int i = 0; i < n; i++) {
+        while (temp_p != NULL && temp_p->data < values[i]) {
+            STATS_VISIT();
+            temp_p = temp_p->next;
+        }
+        int result = temp_p != NULL && temp_p->data == values[i];
+        found += result;
+        if (results != NULL)
+            results[i] = result;
+    }
+
+    Release(&list->lock); // Desbloquear la lista
+    return found;
+}
+
+// Eliminar un tramo ordenado de una franja en una sola pasada con un solo lock
+static int DeleteRun(struct list_stripe* list, const int* values, int n, int* results) {
+    struct list_node_s* garbage = NULL; // Nodos eliminados, se liberan sin el lock
+    int deleted = 0;
+    Acquire(&list->lock); // Bloquear la lista
+    struct list_node_s* curr_p = list->head_p;
+    struct list_node_s* pred_p = NULL;
+
+    for (int i = 0; i < n; i++) {
+        int value = values[i];
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT();
+            pred_p = curr_p;
+            curr_p = curr_p->next;
+        }
+
+        if (curr_p == NULL || curr_p->data != value) {
+            if (results != NULL)
+                results[i] = 0; // Value not found in the list
+            continue;
+        }
+
+        struct list_node_s* next_p = curr_p->next;
+        if (pred_p == NULL) {
+            list->head_p = next_p;
+        } else {
+            pred_p->next = next_p; // Bypass the current node
+        }
+        curr_p->next = garbage;
+        garbage = curr_p;
+        curr_p = next_p;
+        deleted++;
+        if (results != NULL)
+            results[i] = 1;
+    }
+
+    Release(&list->lock); // Desbloquear la lista
+    FreeNodes(garbage);
+    return deleted;
+}
+
+// Aplicar un lote ordenado tramo por tramo: las claves de una misma franja
+// son consecutivas en el lote, así cada franja se bloquea una sola vez
+static int SplitBatch(int (*run)(struct list_stripe*, const int*, int, int*),
+                      const int* values, int n, int* results) {
+    int total = 0;
+    for (int i = 0; i < n; ) {
+        struct list_stripe* list = StripeOf(values[i]);
+        int j = i + 1;
+        while (j < n && StripeOf(values[j]) == list)
+            j++;
+        int hits = run(list, values + i, j - i, results != NULL ? results + i : NULL);
+        if (hits < 0)
+            return -1;
+        total += hits;
+        i = j;
+    }
+    return total;
+}
+
+static int InsertBatch(const int* values, int n, int* results) {
+    return SplitBatch(InsertRun, values, n, results);
+}
+
+static int MemberBatch(const int* values, int n, int* results) {
+    return SplitBatch(MemberRun, values, n, results);
+}
+
+static int DeleteBatch(const int* values, int n, int* results) {
+    return SplitBatch(DeleteRun, values, n, results);
+}
+
+// Recorrer todas las claves en orden, franja por franja con su lock. Con
+// escritores concurrentes no es una instantánea atómica de toda la lista.
+static void ForEach(void (*fn)(int value, void* arg), void* arg) {
+    for (int s = 0; s < num_stripes; s++) {
+        struct list_stripe* list = &stripes[s];
+        Acquire(&list->lock);
+        for (struct list_node_s* temp_p = list->head_p; temp_p != NULL; temp_p = temp_p->next) {
+            fn(temp_p->data, arg);
+        }
+        Release(&list->lock);
+    }
+}
+
+// Inicialización de las listas vacías y de sus locks
+static void Init(void) {
+#if MAX_STRIPES > 1
+    num_stripes = list_stripes < MAX_STRIPES ? list_stripes : MAX_STRIPES;
+    stripe_width = (list_key_range + num_stripes - 1) / num_stripes;
+    if (stripe_width < 1)
+        stripe_width = 1;
+#endif
+    for (int s = 0; s < num_stripes; s++) {
+        stripes[s].head_p = NULL;
+        LOCK_INIT(&stripes[s].lock); // Inicializar el lock
+    }
+    node_pool = pool_create(sizeof(struct list_node_s));
+}
+
+// Limpiar la memoria de la lista enlazada
+static void Destroy(void) {
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    for (int s = 0; s < num_stripes; s++) {
+        stripes[s].head_p = NULL;
+        LOCK_DESTROY(&stripes[s].lock); // Destruir el lock
+    }
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+#ifdef LOCK_THREAD_EXIT
+    LOCK_THREAD_EXIT();
+#endif
+    pool_thread_exit();
+}
+
+const struct list_impl IMPL_SYMBOL = {
+    .name = IMPL_NAME,
+    .description = IMPL_DESCRIPTION,
+    .init = Init,
+    .destroy = Destroy,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+    .InsertBatch = InsertBatch,
+    .MemberBatch = MemberBatch,
+    .DeleteBatch = DeleteBatch,
+    .ForEach = ForEach,
+};
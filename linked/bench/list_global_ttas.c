@@ -0,0 +1,14 @@
+// Lista con un único spinlock test-and-test-and-set (--impl=global-ttas)
+
+#include "locks.h"
+
+#define LOCK_TYPE struct ttas_lock
+#define LOCK_INIT(l) ttas_init(l)
+#define LOCK_DESTROY(l) ((void)(l))
+#define LOCK_ACQUIRE(l) ttas_acquire(l)
+#define LOCK_RELEASE(l) ttas_release(l)
+#define IMPL_SYMBOL list_global_ttas
+#define IMPL_NAME "global-ttas"
+#define IMPL_DESCRIPTION "un spinlock test-and-test-and-set para toda la lista"
+
+#include "list_global_tmpl.h"
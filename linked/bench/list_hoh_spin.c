@@ -0,0 +1,15 @@
+// Lista con un spinlock de un byte por nodo y bloqueo mano a mano
+// (--impl=hoh-spin). El nodo queda en 16 bytes en lugar de 56.
+
+#include "locks.h"
+
+#define LOCK_TYPE struct ttas_lock
+#define LOCK_INIT(l) ttas_init(l)
+#define LOCK_DESTROY(l) ((void)(l))
+#define LOCK_ACQUIRE(l) ttas_acquire(l)
+#define LOCK_RELEASE(l) ttas_release(l)
+#define IMPL_SYMBOL list_hoh_spin
+#define IMPL_NAME "hoh-spin"
+#define IMPL_DESCRIPTION "spinlock de un byte por nodo, bloqueo mano a mano"
+
+#include "list_hoh_tmpl.h"
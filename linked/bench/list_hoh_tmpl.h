@@ -0,0 +1,292 @@
+// Plantilla de la lista con un lock por nodo y bloqueo mano a mano
+// (linked/one_mutex). Cada backend define el tipo de lock de los nodos y
+// después incluye este archivo en su propia unidad de compilación:
+//
+//   LOCK_TYPE           tipo del lock de cada nodo
+//   LOCK_INIT(l)        inicializar un lock (l es un LOCK_TYPE*)
+//   LOCK_DESTROY(l)     destruirlo
+//   LOCK_ACQUIRE(l)     tomarlo; con LIST_STATS vale distinto de 0 si hubo
+//                       que esperar (sin ella el valor se descarta)
+//   LOCK_RELEASE(l)     soltarlo
+//   IMPL_SYMBOL         nombre del struct list_impl que se define
+//   IMPL_NAME           nombre usado en --impl
+//   IMPL_DESCRIPTION    descripción corta para --help
+//
+// Se tienen dos locks a la vez, así que no sirven los locks de cola que
+// usan un solo nodo por hilo (mcs, clh).
+//
+// A diferencia de linked/one_mutex/le*.c, la lista empieza en un nodo
+// centinela con su propio lock, así el primer nodo se protege igual que
+// los demás y nunca se lee head_p sin tener un lock.
+
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+
+#include "list.h"
+#include "pool.h"
+#include "stats.h"
+
+// Tomar y soltar un lock pasando por la instrumentación (stats.h)
+#define Acquire(l) STATS_LOCK((l), LOCK_ACQUIRE(l))
+#define Release(l) STATS_UNLOCK((l), LOCK_RELEASE(l))
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;
+    LOCK_TYPE lock;         // Lock para sincronización (junto a data por si es un byte)
+    struct list_node_s* next;
+};
+
+// Nodo centinela: head.next es el primer elemento de la lista
+static struct list_node_s head;
+static struct node_pool* node_pool; // Nodos reservados fuera de la sección crítica
+
+// Avanzar mano a mano desde pred/curr (bloqueados) hasta el primer nodo con
+// data >= value. Sirve también para seguir un recorrido por lotes.
+static void Advance(int value, struct list_node_s** pred_pp, struct list_node_s** curr_pp) {
+    struct list_node_s* pred_p = *pred_pp;
+    struct list_node_s* curr_p = *curr_pp;
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        Release(&(pred_p->lock)); // Desbloquear el nodo previo
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+        if (curr_p != NULL)
+            Acquire(&(curr_p->lock)); // Bloquear el siguiente nodo
+    }
+
+    *pred_pp = pred_p;
+    *curr_pp = curr_p;
+}
+
+// Recorrer la lista bloqueando mano a mano hasta el primer nodo con
+// data >= value. Al volver, *pred_pp y *curr_pp (si no es NULL) quedan bloqueados.
+static void Locate(int value, struct list_node_s** pred_pp, struct list_node_s** curr_pp) {
+    struct list_node_s* pred_p = &head;
+    Acquire(&(pred_p->lock)); // Bloquear el centinela
+    struct list_node_s* curr_p = pred_p->next;
+    if (curr_p != NULL)
+        Acquire(&(curr_p->lock));
+
+    *pred_pp = pred_p;
+    *curr_pp = curr_p;
+    Advance(value, pred_pp, curr_pp);
+}
+
+// Desbloquear los dos nodos que dejó bloqueados Locate
+static void Unlock(struct list_node_s* pred_p, struct list_node_s* curr_p) {
+    if (curr_p != NULL)
+        Release(&(curr_p->lock));
+    Release(&(pred_p->lock));
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    Locate(value, &pred_p, &curr_p);
+
+    if (curr_p != NULL && curr_p->data == value) {
+        pred_p->next = curr_p->next; // Bypass the current node
+        // Nadie más puede alcanzar curr_p: para llegar a él hay que tener pred_p
+        Unlock(pred_p, curr_p);
+        LOCK_DESTROY(&(curr_p->lock));
+        pool_free(node_pool, curr_p); // Free the memory of the deleted node
+        return 1; // Successful deletion
+    }
+
+    Unlock(pred_p, curr_p);
+    return 0; // Value not found in the list
+}
+
+// Función para verificar si un elemento es miembro de la lista
+static int Member(int value) {
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    Locate(value, &pred_p, &curr_p);
+
+    int found = (curr_p != NULL && curr_p->data == value);
+    Unlock(pred_p, curr_p);
+    return found;
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    // Crear el nuevo nodo antes de tomar cualquier lock
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+    LOCK_INIT(&(temp_p->lock)); // Inicializar el lock correctamente
+
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    Locate(value, &pred_p, &curr_p);
+
+    // El valor ya está en la lista
+    if (curr_p != NULL && curr_p->data == value) {
+        Unlock(pred_p, curr_p);
+        LOCK_DESTROY(&(temp_p->lock));
+        pool_free(node_pool, temp_p);
+        return 0;
+    }
+
+    temp_p->next = curr_p;
+    pred_p->next = temp_p; // Ajustar los enlaces
+    Unlock(pred_p, curr_p);
+    return 1;
+}
+
+// Devolver al pool una cadena de nodos enlazados por next
+static void FreeNodes(struct list_node_s* chain) {
+    while (chain != NULL) {
+        struct list_node_s* next = chain->next;
+        LOCK_DESTROY(&(chain->lock));
+        pool_free(node_pool, chain);
+        chain = next;
+    }
+}
+
+// Insertar un lote ordenado en un solo recorrido mano a mano
+static int InsertBatch(const int* values, int n, int* results) {
+    // Crear todos los nodos antes de tomar cualquier lock
+    struct list_node_s* spare = NULL;
+    for (int i = 0; i < n; i++) {
+        struct list_node_s* node = (struct list_node_s*)pool_alloc(node_pool);
+        if (node == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            FreeNodes(spare);
+            return -1;
+        }
+        LOCK_INIT(&(node->lock));
+        node->next = spare;
+        spare = node;
+    }
+
+    int inserted = 0;
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    Locate(n > 0 ? values[0] : 0, &pred_p, &curr_p);
+
+    for (int i = 0; i < n; i++) {
+        Advance(values[i], &pred_p, &curr_p);
+
+        // El valor ya está en la lista
+        if (curr_p != NULL && curr_p->data == values[i]) {
+            if (results != NULL)
+                results[i] = 0;
+            continue;
+        }
+
+        struct list_node_s* temp_p = spare;
+        spare = spare->next;
+        temp_p->data = values[i];
+        temp_p->next = curr_p;
+        // El nodo nuevo pasa a ser curr: se bloquea antes de hacerlo visible
+        Acquire(&(temp_p->lock));
+        pred_p->next = temp_p;
+        if (curr_p != NULL)
+            Release(&(curr_p->lock));
+        curr_p = temp_p; // Primer nodo con data >= value
+        inserted++;
+        if (results != NULL)
+            results[i] = 1;
+    }
+
+    Unlock(pred_p, curr_p);
+    FreeNodes(spare); // Los que sobraron por claves repetidas
+    return inserted;
+}
+
+// Buscar un lote ordenado en un solo recorrido mano a mano
+static int MemberBatch(const int* values, int n, int* results) {
+    int found = 0;
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    Locate(n > 0 ? values[0] : 0, &pred_p, &curr_p);
+
+    for (int i = 0; i < n; i++) {
+        Advance(values[i], &pred_p, &curr_p);
+        int result = curr_p != NULL && curr_p->data == values[i];
+        found += result;
+        if (results != NULL)
+            results[i] = result;
+    }
+
+    Unlock(pred_p, curr_p);
+    return found;
+}
+
+// Eliminar un lote ordenado en un solo recorrido mano a mano
+static int DeleteBatch(const int* values, int n, int* results) {
+    struct list_node_s* garbage = NULL; // Nodos eliminados, se liberan al final
+    int deleted = 0;
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    Locate(n > 0 ? values[0] : 0, &pred_p, &curr_p);
+
+    for (int i = 0; i < n; i++) {
+        Advance(values[i], &pred_p, &curr_p);
+
+        if (curr_p == NULL || curr_p->data != values[i]) {
+            if (results != NULL)
+                results[i] = 0; // Value not found in the list
+            continue;
+        }
+
+        pred_p->next = curr_p->next; // Bypass the current node
+        // Nadie más puede alcanzar curr_p: para llegar a él hay que tener pred_p
+        Release(&(curr_p->lock));
+        curr_p->next = garbage;
+        garbage = curr_p;
+        curr_p = pred_p->next;
+        if (curr_p != NULL)
+            Acquire(&(curr_p->lock));
+        deleted++;
+        if (results != NULL)
+            results[i] = 1;
+    }
+
+    Unlock(pred_p, curr_p);
+    FreeNodes(garbage);
+    return deleted;
+}
+
+// Inicialización del centinela
+static void Init(void) {
+    head.next = NULL;
+    LOCK_INIT(&(head.lock));
+    node_pool = pool_create(sizeof(struct list_node_s));
+}
+
+// Limpiar la memoria de la lista enlazada
+static void Destroy(void) {
+    struct list_node_s* current = head.next;
+    struct list_node_s* next;
+    while (current != NULL) {
+        next = current->next;
+        LOCK_DESTROY(&(current->lock));
+        current = next;
+    }
+    head.next = NULL;
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+
+    LOCK_DESTROY(&(head.lock));
+}
+
+const struct list_impl IMPL_SYMBOL = {
+    .name = IMPL_NAME,
+    .description = IMPL_DESCRIPTION,
+    .init = Init,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+    .InsertBatch = InsertBatch,
+    .MemberBatch = MemberBatch,
+    .DeleteBatch = DeleteBatch,
+};
@@ -0,0 +1,200 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "ebr.h"
+#include "list.h"
+#include "pool.h"
+#include "stats.h"
+
+// Backend de lista perezosa (lazy list): cada nodo tiene su mutex y una
+// marca de borrado. Member recorre la lista sin tomar ningún lock.
+// Insert y Delete recorren sin locks, bloquean sólo pred y curr y validan
+// que ninguno esté marcado y que pred siga apuntando a curr; si la
+// validación falla vuelven a empezar. Un nodo se marca antes de
+// desenlazarlo, así Member nunca da por presente un valor ya borrado.
+// Los nodos borrados se liberan con recolección por épocas (ebr.c).
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;
+    atomic_int marked;                  // 1 si el nodo fue borrado
+    _Atomic(struct list_node_s*) next;
+    pthread_mutex_t mutex;              // Mutex para sincronización
+};
+
+// Nodo centinela: head.next es el primer elemento de la lista
+static struct list_node_s head;
+static struct node_pool* node_pool;
+
+// Liberar un nodo retirado
+static void FreeNode(void* p) {
+    struct list_node_s* node = (struct list_node_s*)p;
+    pthread_mutex_destroy(&(node->mutex));
+    pool_free(node_pool, node);
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+    ebr_thread_exit();
+    pool_thread_exit();
+}
+
+// Recorrido optimista, sin locks, hasta el primer nodo con data >= value
+static void Locate(int value, struct list_node_s** pred_pp, struct list_node_s** curr_pp) {
+    struct list_node_s* pred_p = &head;
+    struct list_node_s* curr_p = atomic_load_explicit(&head.next, memory_order_acquire);
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        pred_p = curr_p;
+        curr_p = atomic_load_explicit(&curr_p->next, memory_order_acquire);
+    }
+
+    *pred_pp = pred_p;
+    *curr_pp = curr_p;
+}
+
+// Bloquear pred y curr y comprobar que siguen siendo adyacentes y válidos.
+// Si devuelve 0 los locks ya fueron liberados.
+static int LockAndValidate(struct list_node_s* pred_p, struct list_node_s* curr_p) {
+    STATS_MUTEX_LOCK(&(pred_p->mutex));
+    if (curr_p != NULL)
+        STATS_MUTEX_LOCK(&(curr_p->mutex));
+
+    if (!atomic_load_explicit(&pred_p->marked, memory_order_relaxed) &&
+        (curr_p == NULL || !atomic_load_explicit(&curr_p->marked, memory_order_relaxed)) &&
+        atomic_load_explicit(&pred_p->next, memory_order_relaxed) == curr_p)
+        return 1;
+
+    if (curr_p != NULL)
+        STATS_MUTEX_UNLOCK(&(curr_p->mutex));
+    STATS_MUTEX_UNLOCK(&(pred_p->mutex));
+    return 0;
+}
+
+// Desbloquear pred y curr
+static void Unlock(struct list_node_s* pred_p, struct list_node_s* curr_p) {
+    if (curr_p != NULL)
+        STATS_MUTEX_UNLOCK(&(curr_p->mutex));
+    STATS_MUTEX_UNLOCK(&(pred_p->mutex));
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    int result;
+
+    ebr_enter();
+    do {
+        Locate(value, &pred_p, &curr_p);
+    } while (!LockAndValidate(pred_p, curr_p));
+
+    if (curr_p != NULL && curr_p->data == value) {
+        // Borrado lógico y después físico
+        atomic_store_explicit(&curr_p->marked, 1, memory_order_release);
+        atomic_store_explicit(&pred_p->next,
+                              atomic_load_explicit(&curr_p->next, memory_order_relaxed),
+                              memory_order_release);
+        Unlock(pred_p, curr_p);
+        ebr_retire(curr_p, FreeNode);
+        result = 1; // Successful deletion
+    } else {
+        Unlock(pred_p, curr_p);
+        result = 0; // Value not found in the list
+    }
+    ebr_exit();
+    return result;
+}
+
+// Función para verificar si un elemento es miembro de la lista: sin locks y
+// sin liberar memoria (ebr_enter sólo anuncia la época; libera quien retira)
+static int Member(int value) {
+    ebr_enter();
+    struct list_node_s* temp_p = atomic_load_explicit(&head.next, memory_order_acquire);
+
+    while (temp_p != NULL && temp_p->data < value) {
+        STATS_VISIT();
+        temp_p = atomic_load_explicit(&temp_p->next, memory_order_acquire);
+    }
+
+    int found = temp_p != NULL && temp_p->data == value &&
+                !atomic_load_explicit(&temp_p->marked, memory_order_acquire);
+    ebr_exit();
+    return found;
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    struct list_node_s* pred_p;
+    struct list_node_s* curr_p;
+    int result;
+
+    // Crear el nuevo nodo antes de tomar cualquier lock
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+    atomic_init(&temp_p->marked, 0);
+    pthread_mutex_init(&(temp_p->mutex), NULL);
+
+    ebr_enter();
+    do {
+        Locate(value, &pred_p, &curr_p);
+    } while (!LockAndValidate(pred_p, curr_p));
+
+    if (curr_p != NULL && curr_p->data == value) {
+        result = 0; // El valor ya está en la lista
+    } else {
+        atomic_init(&temp_p->next, curr_p);
+        // Publicar el nodo ya inicializado
+        atomic_store_explicit(&pred_p->next, temp_p, memory_order_release);
+        result = 1;
+    }
+    Unlock(pred_p, curr_p);
+    ebr_exit();
+
+    if (result == 0)
+        FreeNode(temp_p); // Nunca fue visible para otros hilos
+    return result;
+}
+
+// Inicialización del centinela
+static void Init(void) {
+    head.data = 0;
+    atomic_init(&head.marked, 0);
+    atomic_init(&head.next, NULL);
+    pthread_mutex_init(&(head.mutex), NULL);
+    node_pool = pool_create(sizeof(struct list_node_s));
+}
+
+// Limpiar la memoria de la lista enlazada (sin hilos trabajando)
+static void Destroy(void) {
+    ebr_drain();
+
+    struct list_node_s* current = atomic_load(&head.next);
+    while (current != NULL) {
+        pthread_mutex_destroy(&(current->mutex));
+        current = atomic_load(&current->next);
+    }
+    atomic_store(&head.next, NULL);
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+
+    pthread_mutex_destroy(&(head.mutex));
+}
+
+const struct list_impl list_lazy = {
+    .name = "lazy",
+    .description = "lista perezosa: Member sin locks, Insert/Delete bloquean pred y curr",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_init = ebr_thread_init,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
@@ -0,0 +1,196 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <stdint.h>     // Para uintptr_t
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "ebr.h"
+#include "list.h"
+#include "pool.h"
+#include "stats.h"
+
+// Backend sin locks (Harris / Michael): los enlaces se cambian con CAS y un
+// nodo se borra en dos pasos. Primero se marca el bit bajo de su campo next
+// (borrado lógico, ya nadie puede enlazar detrás de él) y después se
+// desenlaza del predecesor (borrado físico). Cualquier hilo que encuentre un
+// nodo marcado durante un recorrido ayuda a desenlazarlo. Los nodos
+// desenlazados se liberan con recolección por épocas (ebr.c), nunca mientras
+// otro hilo pueda estar recorriéndolos.
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;
+    _Atomic uintptr_t next;   // Puntero al siguiente nodo | bit de borrado
+};
+
+// Enlace al primer nodo (hace de campo next de un centinela)
+static _Atomic uintptr_t head_next;
+static struct node_pool* node_pool;
+
+#define MARK ((uintptr_t)1)
+
+static inline struct list_node_s* node_of(uintptr_t link) {
+    return (struct list_node_s*)(link & ~MARK);
+}
+
+static inline int is_marked(uintptr_t link) {
+    return (int)(link & MARK);
+}
+
+// Devolver un nodo retirado al pool
+static void FreeNode(void* p) {
+    pool_free(node_pool, p);
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+    ebr_thread_exit();
+    pool_thread_exit();
+}
+
+// Buscar el primer nodo con data >= value desenlazando los nodos marcados
+// que se encuentren. Devuelve en *prev_pp el enlace que apunta a *curr_pp.
+static void Find(int value, _Atomic uintptr_t** prev_pp, struct list_node_s** curr_pp) {
+retry:;
+    _Atomic uintptr_t* prev_p = &head_next;
+    struct list_node_s* curr_p = node_of(atomic_load_explicit(prev_p, memory_order_acquire));
+
+    while (curr_p != NULL) {
+        STATS_VISIT();
+        uintptr_t next = atomic_load_explicit(&curr_p->next, memory_order_acquire);
+
+        if (is_marked(next)) {
+            // curr_p está borrado lógicamente: desenlazarlo
+            uintptr_t expected = (uintptr_t)curr_p;
+            if (!atomic_compare_exchange_strong_explicit(prev_p, &expected, next & ~MARK,
+                                                         memory_order_acq_rel, memory_order_acquire))
+                goto retry; // El predecesor cambió o también fue borrado
+            ebr_retire(curr_p, FreeNode);
+            curr_p = node_of(next);
+            continue;
+        }
+
+        if (curr_p->data >= value)
+            break;
+
+        prev_p = &curr_p->next;
+        curr_p = node_of(next);
+    }
+
+    *prev_pp = prev_p;
+    *curr_pp = curr_p;
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    _Atomic uintptr_t* prev_p;
+    struct list_node_s* curr_p;
+    int result = 0;
+
+    ebr_enter();
+    for (;;) {
+        Find(value, &prev_p, &curr_p);
+        if (curr_p == NULL || curr_p->data != value)
+            break; // Value not found in the list
+
+        // Borrado lógico: marcar el enlace siguiente
+        uintptr_t next = atomic_load_explicit(&curr_p->next, memory_order_acquire);
+        if (is_marked(next))
+            continue; // Otro hilo lo está borrando, Find lo desenlazará
+        if (!atomic_compare_exchange_strong_explicit(&curr_p->next, &next, next | MARK,
+                                                     memory_order_acq_rel, memory_order_acquire))
+            continue;
+
+        // Borrado físico; si falla, Find lo desenlaza por nosotros
+        uintptr_t expected = (uintptr_t)curr_p;
+        if (atomic_compare_exchange_strong_explicit(prev_p, &expected, next,
+                                                    memory_order_acq_rel, memory_order_acquire))
+            ebr_retire(curr_p, FreeNode);
+        else
+            Find(value, &prev_p, &curr_p);
+        result = 1; // Successful deletion
+        break;
+    }
+    ebr_exit();
+    return result;
+}
+
+// Función para verificar si un elemento es miembro de la lista: sólo lee,
+// no escribe en memoria compartida, no ayuda a desenlazar ni libera nodos
+// (ebr_enter sólo anuncia la época)
+static int Member(int value) {
+    ebr_enter();
+    struct list_node_s* temp_p = node_of(atomic_load_explicit(&head_next, memory_order_acquire));
+
+    while (temp_p != NULL && temp_p->data < value) {
+        STATS_VISIT();
+        temp_p = node_of(atomic_load_explicit(&temp_p->next, memory_order_acquire));
+    }
+
+    int found = temp_p != NULL && temp_p->data == value &&
+                !is_marked(atomic_load_explicit(&temp_p->next, memory_order_acquire));
+    ebr_exit();
+    return found;
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    _Atomic uintptr_t* prev_p;
+    struct list_node_s* curr_p;
+    int result;
+
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+
+    ebr_enter();
+    for (;;) {
+        Find(value, &prev_p, &curr_p);
+
+        // El valor ya está en la lista
+        if (curr_p != NULL && curr_p->data == value) {
+            pool_free(node_pool, temp_p); // Nunca fue visible para otros hilos
+            result = 0;
+            break;
+        }
+        atomic_store_explicit(&temp_p->next, (uintptr_t)curr_p, memory_order_relaxed);
+
+        // Publicar el nodo; si el predecesor cambió, buscar de nuevo
+        uintptr_t expected = (uintptr_t)curr_p;
+        if (atomic_compare_exchange_strong_explicit(prev_p, &expected, (uintptr_t)temp_p,
+                                                    memory_order_release, memory_order_relaxed)) {
+            result = 1;
+            break;
+        }
+    }
+    ebr_exit();
+    return result;
+}
+
+// Inicialización de la lista vacía
+static void Init(void) {
+    atomic_store(&head_next, (uintptr_t)0);
+    node_pool = pool_create(sizeof(struct list_node_s));
+}
+
+// Limpiar la memoria de la lista enlazada (sin hilos trabajando)
+static void Destroy(void) {
+    ebr_drain();
+
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    atomic_store(&head_next, (uintptr_t)0);
+}
+
+const struct list_impl list_lockfree = {
+    .name = "lockfree",
+    .description = "sin locks con CAS y borrado lógico (Harris/Michael), memoria por épocas",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_init = ebr_thread_init,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
@@ -0,0 +1,14 @@
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+
+// Backend con un único mutex que protege toda la lista (linked/one_entire)
+
+#define LOCK_TYPE pthread_mutex_t
+#define LOCK_INIT(l) pthread_mutex_init((l), NULL)
+#define LOCK_DESTROY(l) pthread_mutex_destroy(l)
+#define LOCK_ACQUIRE(l) STATS_PROBE(pthread_mutex_trylock(l), pthread_mutex_lock(l))
+#define LOCK_RELEASE(l) pthread_mutex_unlock(l)
+#define IMPL_SYMBOL list_one_entire
+#define IMPL_NAME "global"
+#define IMPL_DESCRIPTION "un mutex para toda la lista (linked/one_entire)"
+
+#include "list_global_tmpl.h"
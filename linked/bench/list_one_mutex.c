@@ -0,0 +1,15 @@
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+
+// Backend con un mutex por nodo y bloqueo mano a mano (linked/one_mutex).
+// Con el pthread_mutex_t dentro, cada nodo ocupa 56 bytes.
+
+#define LOCK_TYPE pthread_mutex_t
+#define LOCK_INIT(l) pthread_mutex_init((l), NULL)
+#define LOCK_DESTROY(l) pthread_mutex_destroy(l)
+#define LOCK_ACQUIRE(l) STATS_PROBE(pthread_mutex_trylock(l), pthread_mutex_lock(l))
+#define LOCK_RELEASE(l) pthread_mutex_unlock(l)
+#define IMPL_SYMBOL list_one_mutex
+#define IMPL_NAME "hoh"
+#define IMPL_DESCRIPTION "un mutex por nodo, bloqueo mano a mano (linked/one_mutex)"
+
+#include "list_hoh_tmpl.h"
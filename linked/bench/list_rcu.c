@@ -0,0 +1,147 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "list.h"
+#include "pool.h"
+#include "rcu.h"
+#include "stats.h"
+
+// Backend estilo RCU (rcu.c). Member recorre la lista dentro de una
+// sección de lectura que sólo escribe el contador propio del hilo: no toma
+// locks ni hace operaciones atómicas sobre líneas compartidas. Insert y
+// Delete se serializan con un mutex y publican los cambios con stores
+// release. Un nodo borrado se entrega al hilo recolector, que lo libera
+// tras un periodo de gracia; mientras tanto sigue apuntando a su sucesor,
+// así un lector que esté sobre él termina su recorrido normalmente.
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;                           // No cambia mientras el nodo está en la lista
+    _Atomic(struct list_node_s*) next;
+};
+
+static _Atomic(struct list_node_s*) head_p = NULL;
+static struct node_pool* node_pool; // Nodos reservados fuera de la sección crítica
+static pthread_mutex_t write_mutex; // Serializa a los escritores
+
+// Liberar un nodo (desde el hilo recolector)
+static void FreeNode(void* p) {
+    pool_free(node_pool, p);
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+    rcu_thread_exit();
+    pool_thread_exit();
+}
+
+// Recorrer la lista hasta el primer nodo con data >= value
+static void Locate(int value, _Atomic(struct list_node_s*)** link_pp, struct list_node_s** curr_pp) {
+    _Atomic(struct list_node_s*)* link_p = &head_p;
+    struct list_node_s* curr_p = atomic_load_explicit(link_p, memory_order_acquire);
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        link_p = &curr_p->next;
+        curr_p = atomic_load_explicit(link_p, memory_order_acquire);
+    }
+
+    *link_pp = link_p;
+    *curr_pp = curr_p;
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    _Atomic(struct list_node_s*)* link_p;
+    struct list_node_s* curr_p;
+
+    STATS_MUTEX_LOCK(&write_mutex); // Bloquear a los demás escritores
+    Locate(value, &link_p, &curr_p);
+
+    // Value not found in the list
+    if (curr_p == NULL || curr_p->data != value) {
+        STATS_MUTEX_UNLOCK(&write_mutex);
+        return 0;
+    }
+
+    atomic_store_explicit(link_p, atomic_load_explicit(&curr_p->next, memory_order_relaxed),
+                          memory_order_release);
+    STATS_MUTEX_UNLOCK(&write_mutex);
+
+    rcu_defer(curr_p, FreeNode); // Se libera cuando ningún lector pueda verlo
+    return 1;
+}
+
+// Función para verificar si un elemento es miembro de la lista (sin locks)
+static int Member(int value) {
+    _Atomic(struct list_node_s*)* link_p;
+    struct list_node_s* curr_p;
+
+    rcu_read_lock();
+    Locate(value, &link_p, &curr_p);
+    int found = curr_p != NULL && curr_p->data == value;
+    rcu_read_unlock();
+    return found;
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    _Atomic(struct list_node_s*)* link_p;
+    struct list_node_s* curr_p;
+
+    // Reservar el nodo antes de tomar el lock
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+
+    STATS_MUTEX_LOCK(&write_mutex); // Bloquear a los demás escritores
+    Locate(value, &link_p, &curr_p);
+
+    // El valor ya está en la lista
+    if (curr_p != NULL && curr_p->data == value) {
+        STATS_MUTEX_UNLOCK(&write_mutex);
+        pool_free(node_pool, temp_p);
+        return 0;
+    }
+
+    atomic_init(&temp_p->next, curr_p);
+    // Publicar el nodo ya inicializado
+    atomic_store_explicit(link_p, temp_p, memory_order_release);
+
+    STATS_MUTEX_UNLOCK(&write_mutex);
+    return 1;
+}
+
+// Inicialización de la lista vacía, del mutex y del recolector
+static void Init(void) {
+    atomic_init(&head_p, NULL);
+    node_pool = pool_create(sizeof(struct list_node_s));
+    pthread_mutex_init(&write_mutex, NULL);
+    rcu_start();
+}
+
+// Limpiar la memoria de la lista enlazada (sin hilos trabajando)
+static void Destroy(void) {
+    rcu_stop(); // Libera lo pendiente antes de destruir el pool
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    atomic_store(&head_p, NULL);
+
+    pthread_mutex_destroy(&write_mutex);
+}
+
+const struct list_impl list_rcu = {
+    .name = "rcu",
+    .description = "estilo RCU: Member sin locks, recolector libera tras un periodo de gracia",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_init = rcu_thread_init,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
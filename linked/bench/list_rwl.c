@@ -0,0 +1,328 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include "list.h"
+#include "pool.h"
+#include "rwlock.h"
+#include "stats.h"
+
+// Backend con un read-write lock que protege toda la lista (linked/rwl).
+// Cada variante registrada usa una política distinta del lock (rwlock.h).
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;
+    struct list_node_s* next;
+};
+
+// Declaración de la variable global head_p y el read-write lock para la lista
+static struct list_node_s* head_p = NULL;
+static struct node_pool* node_pool; // Nodos reservados fuera de la sección crítica
+static struct rw_lock rwlock;    // Read-write lock para proteger toda la lista
+
+// Tomar y soltar el lock pasando por la instrumentación (stats.h)
+#define ReadLock() STATS_LOCK(&rwlock, rw_rdlock(&rwlock))
+#define ReadUnlock() STATS_UNLOCK(&rwlock, rw_rdunlock(&rwlock))
+#define WriteLock() STATS_LOCK(&rwlock, rw_wrlock(&rwlock))
+#define WriteUnlock() STATS_UNLOCK(&rwlock, rw_wrunlock(&rwlock))
+
+// Función para eliminar un nodo (write lock)
+static int Delete(int value) {
+    WriteLock(); // Bloquear con write lock
+    struct list_node_s* curr_p = head_p;
+    struct list_node_s* pred_p = NULL;
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+    }
+
+    // Si se encontró el nodo a eliminar
+    if (curr_p != NULL && curr_p->data == value) {
+        if (pred_p == NULL) { // Deleting the first node
+            head_p = curr_p->next; // Update head pointer
+        } else {
+            pred_p->next = curr_p->next; // Bypass the current node
+        }
+        WriteUnlock(); // Desbloquear el write lock
+        pool_free(node_pool, curr_p); // Free the memory of the deleted node
+        return 1; // Successful deletion
+    }
+
+    WriteUnlock(); // Desbloquear el write lock
+    return 0; // Value not found in the list
+}
+
+// Función para verificar si un elemento es miembro de la lista (read lock)
+static int Member(int value) {
+    ReadLock(); // Bloquear con read lock
+    struct list_node_s* temp_p = head_p;
+
+    while (temp_p != NULL && temp_p->data < value) {
+        STATS_VISIT();
+        temp_p = temp_p->next;
+    }
+
+    if (temp_p == NULL || temp_p->data > value) {
+        ReadUnlock(); // Desbloquear el read lock
+        return 0; // No encontrado
+    } else {
+        ReadUnlock(); // Desbloquear el read lock
+        return 1; // Encontrado
+    }
+}
+
+// Función para insertar un nodo (write lock, no inserta duplicados)
+static int Insert(int value) {
+    // Reservar el nodo antes de tomar el lock
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+
+    WriteLock(); // Bloquear con write lock
+    struct list_node_s* curr_p = head_p;
+    struct list_node_s* pred_p = NULL;
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+    }
+
+    // El valor ya está en la lista
+    if (curr_p != NULL && curr_p->data == value) {
+        WriteUnlock(); // Desbloquear el write lock
+        pool_free(node_pool, temp_p);
+        return 0;
+    }
+
+    temp_p->next = curr_p;
+
+    // Insertar en la lista ordenada
+    if (pred_p == NULL) {
+        head_p = temp_p;
+    } else {
+        pred_p->next = temp_p;
+    }
+
+    WriteUnlock(); // Desbloquear el write lock
+    return 1;
+}
+
+// Devolver al pool una cadena de nodos enlazados por next
+static void FreeNodes(struct list_node_s* chain) {
+    while (chain != NULL) {
+        struct list_node_s* next = chain->next;
+        pool_free(node_pool, chain);
+        chain = next;
+    }
+}
+
+// Reservar `n` nodos encadenados por next (NULL si falló la memoria)
+static struct list_node_s* AllocNodes(int n) {
+    struct list_node_s* chain = NULL;
+    for (int i = 0; i < n; i++) {
+        struct list_node_s* node = (struct list_node_s*)pool_alloc(node_pool);
+        if (node == NULL) {
+            FreeNodes(chain);
+            return NULL;
+        }
+        node->next = chain;
+        chain = node;
+    }
+    return chain;
+}
+
+// Insertar un lote ordenado en una sola pasada con un solo lock
+static int InsertBatch(const int* values, int n, int* results) {
+    // Reservar todos los nodos antes de tomar el lock
+    struct list_node_s* spare = AllocNodes(n);
+    if (spare == NULL && n > 0) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+
+    int inserted = 0;
+    WriteLock(); // Bloquear con write lock
+    struct list_node_s* curr_p = head_p;
+    struct list_node_s* pred_p = NULL;
+
+    for (int i = 0; i < n; i++) {
+        int value = values[i];
+        // Las claves están ordenadas: se sigue desde donde quedó la anterior
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT();
+            pred_p = curr_p;
+            curr_p = curr_p->next;
+        }
+
+        // El valor ya está en la lista
+        if (curr_p != NULL && curr_p->data == value) {
+            if (results != NULL)
+                results[i] = 0;
+            continue;
+        }
+
+        struct list_node_s* temp_p = spare;
+        spare = spare->next;
+        temp_p->data = value;
+        temp_p->next = curr_p;
+        if (pred_p == NULL) {
+            head_p = temp_p;
+        } else {
+            pred_p->next = temp_p;
+        }
+        curr_p = temp_p; // Primer nodo con data >= value
+        inserted++;
+        if (results != NULL)
+            results[i] = 1;
+    }
+
+    WriteUnlock(); // Desbloquear el write lock
+    FreeNodes(spare); // Los que sobraron por claves repetidas
+    return inserted;
+}
+
+// Buscar un lote ordenado en una sola pasada
+static int MemberBatch(const int* values, int n, int* results) {
+    int found = 0;
+    ReadLock(); // Bloquear con read lock
+    struct list_node_s* temp_p = head_p;
+
+    for (int i = 0; i < n; i++) {
+        while (temp_p != NULL && temp_p->data < values[i]) {
+            STATS_VISIT();
+            temp_p = temp_p->next;
+        }
+        int result = temp_p != NULL && temp_p->data == values[i];
+        found += result;
+        if (results != NULL)
+            results[i] = result;
+    }
+
+    ReadUnlock(); // Desbloquear el read lock
+    return found;
+}
+
+// Eliminar un lote ordenado en una sola pasada con un solo lock
+static int DeleteBatch(const int* values, int n, int* results) {
+    struct list_node_s* garbage = NULL; // Nodos eliminados, se liberan sin el lock
+    int deleted = 0;
+    WriteLock(); // Bloquear con write lock
+    struct list_node_s* curr_p = head_p;
+    struct list_node_s* pred_p = NULL;
+
+    for (int i = 0; i < n; i++) {
+        int value = values[i];
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT();
+            pred_p = curr_p;
+            curr_p = curr_p->next;
+        }
+
+        if (curr_p == NULL || curr_p->data != value) {
+            if (results != NULL)
+                results[i] = 0; // Value not found in the list
+            continue;
+        }
+
+        struct list_node_s* next_p = curr_p->next;
+        if (pred_p == NULL) {
+            head_p = next_p;
+        } else {
+            pred_p->next = next_p; // Bypass the current node
+        }
+        curr_p->next = garbage;
+        garbage = curr_p;
+        curr_p = next_p;
+        deleted++;
+        if (results != NULL)
+            results[i] = 1;
+    }
+
+    WriteUnlock(); // Desbloquear el write lock
+    FreeNodes(garbage);
+    return deleted;
+}
+
+// Inicialización del nodo cabeza y del read-write lock
+static void Init(enum rw_policy policy) {
+    head_p = NULL;
+    node_pool = pool_create(sizeof(struct list_node_s));
+    if (rw_init(&rwlock, policy) != 0) { // Inicializar el read-write lock
+        fprintf(stderr, "Error al inicializar el read-write lock\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void InitPthread(void) { Init(RW_PTHREAD); }
+static void InitWriter(void) { Init(RW_PTHREAD_WRITER); }
+static void InitBiased(void) { Init(RW_BIASED); }
+static void InitPhaseFair(void) { Init(RW_PHASE_FAIR); }
+
+// Limpiar la memoria de la lista enlazada
+static void Destroy(void) {
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    head_p = NULL;
+
+    rw_destroy(&rwlock); // Destruir el read-write lock
+}
+
+const struct list_impl list_rwl = {
+    .name = "rwlock",
+    .description = "un read-write lock para toda la lista (linked/rwl)",
+    .init = InitPthread,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+    .InsertBatch = InsertBatch,
+    .MemberBatch = MemberBatch,
+    .DeleteBatch = DeleteBatch,
+};
+
+const struct list_impl list_rwl_writer = {
+    .name = "rwlock-writer",
+    .description = "rwlock de glibc con preferencia a escritores",
+    .init = InitWriter,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+    .InsertBatch = InsertBatch,
+    .MemberBatch = MemberBatch,
+    .DeleteBatch = DeleteBatch,
+};
+
+const struct list_impl list_rwl_biased = {
+    .name = "rwlock-biased",
+    .description = "rwlock sesgado a lectores, un contador de lectura por hilo",
+    .init = InitBiased,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+    .InsertBatch = InsertBatch,
+    .MemberBatch = MemberBatch,
+    .DeleteBatch = DeleteBatch,
+};
+
+const struct list_impl list_rwl_pf = {
+    .name = "rwlock-pf",
+    .description = "rwlock phase-fair con tickets",
+    .init = InitPhaseFair,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+    .InsertBatch = InsertBatch,
+    .MemberBatch = MemberBatch,
+    .DeleteBatch = DeleteBatch,
+};
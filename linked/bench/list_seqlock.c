@@ -0,0 +1,207 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "ebr.h"
+#include "list.h"
+#include "pool.h"
+#include "spin.h"
+#include "stats.h"
+
+// Backend con un mutex global y lecturas optimistas con seqlock (variante
+// de linked/one_entire). Insert y Delete se serializan con list_mutex como
+// en "global" y, sólo cuando modifican la lista, dejan el contador de
+// versión en impar mientras cambian los enlaces. Member no toma el mutex ni
+// escribe en ninguna línea compartida: espera con spin_relax mientras la
+// versión es impar, recorre la lista y, si la versión cambió durante el
+// recorrido, vuelve a intentar. Sólo esas validaciones fallidas cuentan:
+// tras SEQ_MAX_RETRIES toma el mutex para no quedarse sin turno bajo una
+// ráfaga de escrituras.
+//
+// Un lector puede estar recorriendo un nodo que un escritor acaba de
+// desenlazar, así que los nodos borrados se liberan con recolección por
+// épocas (ebr.c): nunca se desreferencia un nodo liberado.
+//
+// Comparar con el read lock de linked/rwl: --impl=seqlock,rwlock
+
+#define SEQ_MAX_RETRIES 8
+
+// Definición de la estructura para los nodos de una lista enlazada
+struct list_node_s {
+    int data;                           // No cambia mientras el nodo está en la lista
+    _Atomic(struct list_node_s*) next;
+};
+
+static _Atomic(struct list_node_s*) head_p = NULL;
+static struct node_pool* node_pool; // Nodos reservados fuera de la sección crítica
+static pthread_mutex_t list_mutex;  // Serializa a los escritores
+
+// Versión de la lista: impar mientras un escritor la está modificando.
+// En su propia línea de caché para no compartirla con el mutex.
+static struct {
+    atomic_uint value;
+} __attribute__((aligned(64))) seq;
+
+// Liberar un nodo retirado
+static void FreeNode(void* p) {
+    pool_free(node_pool, p);
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+    ebr_thread_exit();
+    pool_thread_exit();
+}
+
+// Empezar / terminar una modificación (con list_mutex tomado)
+static void WriteBegin(void) {
+    unsigned s = atomic_load_explicit(&seq.value, memory_order_relaxed);
+    atomic_store_explicit(&seq.value, s + 1, memory_order_relaxed);
+    // Los enlaces que se escriban después no pueden adelantarse a la versión impar
+    atomic_thread_fence(memory_order_release);
+}
+
+static void WriteEnd(void) {
+    unsigned s = atomic_load_explicit(&seq.value, memory_order_relaxed);
+    atomic_store_explicit(&seq.value, s + 1, memory_order_release);
+}
+
+// Recorrer la lista hasta el primer nodo con data >= value
+static void Locate(int value, _Atomic(struct list_node_s*)** link_pp, struct list_node_s** curr_pp) {
+    _Atomic(struct list_node_s*)* link_p = &head_p;
+    struct list_node_s* curr_p = atomic_load_explicit(link_p, memory_order_acquire);
+
+    while (curr_p != NULL && curr_p->data < value) {
+        STATS_VISIT();
+        link_p = &curr_p->next;
+        curr_p = atomic_load_explicit(link_p, memory_order_acquire);
+    }
+
+    *link_pp = link_p;
+    *curr_pp = curr_p;
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    _Atomic(struct list_node_s*)* link_p;
+    struct list_node_s* curr_p;
+    int result = 0;
+
+    ebr_enter();
+    STATS_MUTEX_LOCK(&list_mutex); // Bloquear el mutex de la lista
+    Locate(value, &link_p, &curr_p);
+
+    // Si se encontró el nodo a eliminar
+    if (curr_p != NULL && curr_p->data == value) {
+        WriteBegin();
+        // El nodo desenlazado sigue apuntando a su sucesor, así un lector
+        // que esté sobre él termina su recorrido normalmente
+        atomic_store_explicit(link_p, atomic_load_explicit(&curr_p->next, memory_order_relaxed),
+                              memory_order_relaxed);
+        WriteEnd();
+        result = 1;
+    }
+
+    STATS_MUTEX_UNLOCK(&list_mutex); // Desbloquear el mutex
+    if (result)
+        ebr_retire(curr_p, FreeNode);
+    ebr_exit();
+    return result;
+}
+
+// Función para verificar si un elemento es miembro de la lista
+static int Member(int value) {
+    _Atomic(struct list_node_s*)* link_p;
+    struct list_node_s* curr_p;
+    int found;
+
+    ebr_enter();
+    unsigned spins = 0;
+    for (int attempt = 0; attempt < SEQ_MAX_RETRIES; attempt++) {
+        unsigned before;
+        // Un escritor está cambiando la lista: esperar sin gastar un intento
+        while ((before = atomic_load_explicit(&seq.value, memory_order_acquire)) & 1)
+            spin_relax(&spins);
+
+        Locate(value, &link_p, &curr_p);
+        found = curr_p != NULL && curr_p->data == value;
+
+        // Validar que ningún escritor intervino durante el recorrido
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&seq.value, memory_order_relaxed) == before) {
+            ebr_exit();
+            return found;
+        }
+    }
+    ebr_exit();
+
+    // Demasiados reintentos: leer con el mutex
+    STATS_MUTEX_LOCK(&list_mutex);
+    Locate(value, &link_p, &curr_p);
+    found = curr_p != NULL && curr_p->data == value;
+    STATS_MUTEX_UNLOCK(&list_mutex);
+    return found;
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    _Atomic(struct list_node_s*)* link_p;
+    struct list_node_s* curr_p;
+
+    // Reservar el nodo antes de tomar el lock
+    struct list_node_s* temp_p = (struct list_node_s*)pool_alloc(node_pool);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+    temp_p->data = value;
+
+    STATS_MUTEX_LOCK(&list_mutex); // Bloquear el mutex de la lista
+    Locate(value, &link_p, &curr_p);
+
+    // El valor ya está en la lista
+    if (curr_p != NULL && curr_p->data == value) {
+        STATS_MUTEX_UNLOCK(&list_mutex); // Desbloquear el mutex
+        pool_free(node_pool, temp_p);
+        return 0;
+    }
+
+    atomic_init(&temp_p->next, curr_p);
+    WriteBegin();
+    // Publicar el nodo ya inicializado
+    atomic_store_explicit(link_p, temp_p, memory_order_release);
+    WriteEnd();
+
+    STATS_MUTEX_UNLOCK(&list_mutex); // Desbloquear el mutex
+    return 1;
+}
+
+// Inicialización de la lista vacía y del mutex
+static void Init(void) {
+    atomic_init(&head_p, NULL);
+    atomic_init(&seq.value, 0);
+    node_pool = pool_create(sizeof(struct list_node_s));
+    pthread_mutex_init(&list_mutex, NULL); // Inicializar el mutex
+}
+
+// Limpiar la memoria de la lista enlazada (sin hilos trabajando)
+static void Destroy(void) {
+    ebr_drain();
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    atomic_store(&head_p, NULL);
+
+    pthread_mutex_destroy(&list_mutex); // Destruir el mutex
+}
+
+const struct list_impl list_seqlock = {
+    .name = "seqlock",
+    .description = "mutex global para escribir, Member optimista con seqlock",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_init = ebr_thread_init,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
@@ -0,0 +1,333 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <stdint.h>     // Para uint64_t
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "ebr.h"
+#include "list.h"
+#include "pool.h"
+#include "spin.h"
+#include "stats.h"
+
+// Backend de skip list concurrente (algoritmo optimista de Herlihy, Lev,
+// Luchangco y Shavit). Cada nodo aparece en los niveles 0..top_level-1 y
+// los niveles superiores saltan cada vez más nodos, así buscar cuesta
+// O(log n) en lugar de recorrer toda la lista.
+//
+// Igual que en list_lazy.c, Member no toma locks: Insert y Delete buscan sin
+// locks, bloquean sólo los predecesores de cada nivel y validan antes de
+// modificar. Un nodo es visible cuando fully_linked vale 1 y deja de serlo
+// cuando se marca; los nodos borrados se liberan con ebr.c.
+
+#define MAX_LEVEL 24    // Suficiente para ~16 millones de elementos con p = 1/2
+
+// Definición de la estructura para los nodos de la skip list
+struct skip_node_s {
+    int data;
+    int top_level;                          // Número de niveles del nodo
+    atomic_int marked;                      // 1 si el nodo fue borrado
+    atomic_int fully_linked;                // 1 cuando está enlazado en todos sus niveles
+    pthread_mutex_t mutex;                  // Mutex para sincronización
+    _Atomic(struct skip_node_s*) next[];    // Un enlace por nivel
+};
+
+// Nodo centinela con MAX_LEVEL niveles; NULL hace de +infinito
+static struct skip_node_s* head_p;
+
+// Un pool por altura de nodo: pools[l - 1] guarda nodos de l niveles
+static struct node_pool* pools[MAX_LEVEL];
+
+// Generador por hilo para elegir la altura de los nodos nuevos
+static __thread uint64_t level_seed;
+
+// Altura aleatoria con distribución geométrica de p = 1/2
+static int RandomLevel(void) {
+    if (level_seed == 0)
+        level_seed = (uint64_t)(uintptr_t)&level_seed | 1;
+    uint64_t x = level_seed;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    level_seed = x;
+
+    int level = 1 + __builtin_ctzll(~x); // Bits 1 consecutivos desde el menos significativo
+    return level < MAX_LEVEL ? level : MAX_LEVEL;
+}
+
+// Crear un nodo de `levels` niveles
+static struct skip_node_s* NewNode(int value, int levels) {
+    struct skip_node_s* node = pool_alloc(pools[levels - 1]);
+    if (node == NULL)
+        return NULL;
+    node->data = value;
+    node->top_level = levels;
+    atomic_init(&node->marked, 0);
+    atomic_init(&node->fully_linked, 0);
+    pthread_mutex_init(&(node->mutex), NULL);
+    for (int l = 0; l < levels; l++) {
+        atomic_init(&node->next[l], NULL);
+    }
+    return node;
+}
+
+// Liberar un nodo retirado
+static void FreeNode(void* p) {
+    struct skip_node_s* node = (struct skip_node_s*)p;
+    pthread_mutex_destroy(&(node->mutex));
+    pool_free(pools[node->top_level - 1], node);
+}
+
+// Al terminar cada hilo de trabajo
+static void ThreadExit(void) {
+    ebr_thread_exit();
+    pool_thread_exit();
+}
+
+static inline struct skip_node_s* Next(struct skip_node_s* node, int level) {
+    return atomic_load_explicit(&node->next[level], memory_order_acquire);
+}
+
+// Buscar `value` sin locks. Llena preds/succs por nivel y devuelve el nivel
+// más alto en el que se encontró el valor, o -1 si no está.
+static int Find(int value, struct skip_node_s* preds[], struct skip_node_s* succs[]) {
+    int found_level = -1;
+    struct skip_node_s* pred_p = head_p;
+
+    for (int l = MAX_LEVEL - 1; l >= 0; l--) {
+        struct skip_node_s* curr_p = Next(pred_p, l);
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT();
+            pred_p = curr_p;
+            curr_p = Next(pred_p, l);
+        }
+        if (found_level == -1 && curr_p != NULL && curr_p->data == value)
+            found_level = l;
+        preds[l] = pred_p;
+        succs[l] = curr_p;
+    }
+    return found_level;
+}
+
+// Desbloquear los predecesores distintos de los niveles 0..highest
+static void UnlockPreds(struct skip_node_s* preds[], int highest) {
+    struct skip_node_s* prev_p = NULL;
+    for (int l = 0; l <= highest; l++) {
+        if (preds[l] != prev_p) {
+            STATS_MUTEX_UNLOCK(&(preds[l]->mutex));
+            prev_p = preds[l];
+        }
+    }
+}
+
+// Función para verificar si un elemento es miembro de la lista: sin locks y
+// sin liberar memoria (ebr_enter sólo anuncia la época; libera quien retira)
+static int Member(int value) {
+    ebr_enter();
+    struct skip_node_s* pred_p = head_p;
+    struct skip_node_s* curr_p = NULL;
+
+    for (int l = MAX_LEVEL - 1; l >= 0; l--) {
+        curr_p = Next(pred_p, l);
+        while (curr_p != NULL && curr_p->data < value) {
+            STATS_VISIT();
+            pred_p = curr_p;
+            curr_p = Next(pred_p, l);
+        }
+        if (curr_p != NULL && curr_p->data == value)
+            break;
+    }
+
+    int found = curr_p != NULL && curr_p->data == value &&
+                atomic_load_explicit(&curr_p->fully_linked, memory_order_acquire) &&
+                !atomic_load_explicit(&curr_p->marked, memory_order_acquire);
+    ebr_exit();
+    return found;
+}
+
+// Función para insertar un nodo (no inserta duplicados)
+static int Insert(int value) {
+    struct skip_node_s* preds[MAX_LEVEL];
+    struct skip_node_s* succs[MAX_LEVEL];
+    int top_level = RandomLevel();
+    int result;
+
+    // Crear el nuevo nodo antes de tomar cualquier lock
+    struct skip_node_s* temp_p = NewNode(value, top_level);
+    if (temp_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return -1;
+    }
+
+    ebr_enter();
+    for (;;) {
+        int found_level = Find(value, preds, succs);
+        if (found_level != -1) {
+            struct skip_node_s* found_p = succs[found_level];
+            if (!atomic_load_explicit(&found_p->marked, memory_order_acquire)) {
+                // Otro hilo lo está insertando: esperar a que termine
+                unsigned spins = 0;
+                while (!atomic_load_explicit(&found_p->fully_linked, memory_order_acquire))
+                    spin_relax(&spins);
+                result = 0; // El valor ya está en la lista
+                break;
+            }
+            continue; // Se está borrando: reintentar
+        }
+
+        // Bloquear los predecesores y validar nivel por nivel
+        int highest_locked = -1;
+        int valid = 1;
+        struct skip_node_s* prev_p = NULL;
+        for (int l = 0; valid && l < top_level; l++) {
+            struct skip_node_s* pred_p = preds[l];
+            struct skip_node_s* succ_p = succs[l];
+            if (pred_p != prev_p) {
+                STATS_MUTEX_LOCK(&(pred_p->mutex));
+                prev_p = pred_p;
+            }
+            highest_locked = l;
+            valid = !atomic_load_explicit(&pred_p->marked, memory_order_relaxed) &&
+                    (succ_p == NULL || !atomic_load_explicit(&succ_p->marked, memory_order_relaxed)) &&
+                    Next(pred_p, l) == succ_p;
+        }
+        if (!valid) {
+            UnlockPreds(preds, highest_locked);
+            continue;
+        }
+
+        for (int l = 0; l < top_level; l++) {
+            atomic_init(&temp_p->next[l], succs[l]);
+        }
+        // Enlazar de abajo hacia arriba: el nivel 0 define la pertenencia
+        for (int l = 0; l < top_level; l++) {
+            atomic_store_explicit(&preds[l]->next[l], temp_p, memory_order_release);
+        }
+        atomic_store_explicit(&temp_p->fully_linked, 1, memory_order_release);
+        UnlockPreds(preds, highest_locked);
+        result = 1;
+        break;
+    }
+    ebr_exit();
+
+    if (result == 0)
+        FreeNode(temp_p); // Nunca fue visible para otros hilos
+    return result;
+}
+
+// Función para eliminar un nodo
+static int Delete(int value) {
+    struct skip_node_s* preds[MAX_LEVEL];
+    struct skip_node_s* succs[MAX_LEVEL];
+    struct skip_node_s* victim_p = NULL;
+    int is_marked = 0;
+    int top_level = -1;
+    int result;
+
+    ebr_enter();
+    for (;;) {
+        int found_level = Find(value, preds, succs);
+
+        if (!is_marked) {
+            // Sólo se borra un nodo enlazado del todo y encontrado en su nivel más alto
+            if (found_level == -1) {
+                result = 0; // Value not found in the list
+                break;
+            }
+            victim_p = succs[found_level];
+            if (!atomic_load_explicit(&victim_p->fully_linked, memory_order_acquire) ||
+                victim_p->top_level - 1 != found_level ||
+                atomic_load_explicit(&victim_p->marked, memory_order_acquire)) {
+                result = 0;
+                break;
+            }
+
+            top_level = victim_p->top_level;
+            STATS_MUTEX_LOCK(&(victim_p->mutex));
+            if (atomic_load_explicit(&victim_p->marked, memory_order_relaxed)) {
+                STATS_MUTEX_UNLOCK(&(victim_p->mutex));
+                result = 0; // Otro hilo lo borró primero
+                break;
+            }
+            atomic_store_explicit(&victim_p->marked, 1, memory_order_release);
+            is_marked = 1;
+        }
+
+        // Bloquear los predecesores y validar que siguen apuntando a la víctima
+        int highest_locked = -1;
+        int valid = 1;
+        struct skip_node_s* prev_p = NULL;
+        for (int l = 0; valid && l < top_level; l++) {
+            struct skip_node_s* pred_p = preds[l];
+            if (pred_p != prev_p) {
+                STATS_MUTEX_LOCK(&(pred_p->mutex));
+                prev_p = pred_p;
+            }
+            highest_locked = l;
+            valid = !atomic_load_explicit(&pred_p->marked, memory_order_relaxed) &&
+                    Next(pred_p, l) == victim_p;
+        }
+        if (!valid) {
+            UnlockPreds(preds, highest_locked);
+            continue;
+        }
+
+        // Desenlazar de arriba hacia abajo
+        for (int l = top_level - 1; l >= 0; l--) {
+            atomic_store_explicit(&preds[l]->next[l], Next(victim_p, l), memory_order_release);
+        }
+        STATS_MUTEX_UNLOCK(&(victim_p->mutex));
+        UnlockPreds(preds, highest_locked);
+        ebr_retire(victim_p, FreeNode);
+        result = 1; // Successful deletion
+        break;
+    }
+    ebr_exit();
+    return result;
+}
+
+// Inicialización del centinela
+static void Init(void) {
+    for (int l = 0; l < MAX_LEVEL; l++) {
+        pools[l] = pool_create(sizeof(struct skip_node_s) +
+                               (l + 1) * sizeof(_Atomic(struct skip_node_s*)));
+    }
+    head_p = NewNode(0, MAX_LEVEL);
+    if (head_p == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_store(&head_p->fully_linked, 1);
+}
+
+// Limpiar la memoria de la skip list (sin hilos trabajando)
+static void Destroy(void) {
+    ebr_drain();
+
+    struct skip_node_s* current = atomic_load(&head_p->next[0]);
+    struct skip_node_s* next;
+    while (current != NULL) {
+        next = atomic_load(&current->next[0]);
+        pthread_mutex_destroy(&(current->mutex));
+        current = next;
+    }
+    pthread_mutex_destroy(&(head_p->mutex));
+    head_p = NULL;
+
+    // Libera todos los nodos de una vez
+    for (int l = 0; l < MAX_LEVEL; l++) {
+        pool_destroy(pools[l]);
+    }
+}
+
+const struct list_impl list_skiplist = {
+    .name = "skiplist",
+    .description = "skip list optimista O(log n): Member sin locks, memoria por épocas",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_init = ebr_thread_init,
+    .thread_exit = ThreadExit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
@@ -0,0 +1,19 @@
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+
+// Backend por franjas (--impl=striped): el rango de claves se parte en
+// --stripes franjas contiguas, cada una con su propia lista y su propio
+// mutex, con el mismo código que "global". Dos operaciones sólo compiten
+// si sus claves caen en la misma franja.
+
+#define MAX_STRIPES LIST_MAX_STRIPES
+
+#define LOCK_TYPE pthread_mutex_t
+#define LOCK_INIT(l) pthread_mutex_init((l), NULL)
+#define LOCK_DESTROY(l) pthread_mutex_destroy(l)
+#define LOCK_ACQUIRE(l) STATS_PROBE(pthread_mutex_trylock(l), pthread_mutex_lock(l))
+#define LOCK_RELEASE(l) pthread_mutex_unlock(l)
+#define IMPL_SYMBOL list_striped
+#define IMPL_NAME "striped"
+#define IMPL_DESCRIPTION "franjas de claves contiguas, cada una con su lista y su mutex"
+
+#include "list_global_tmpl.h"
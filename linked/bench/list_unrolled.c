@@ -0,0 +1,251 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para memcpy
+#include <pthread.h>    // Para funciones de manejo de hilos, mutex y read-write locks
+
+#include "list.h"
+#include "pool.h"
+#include "stats.h"
+#include "unrolled.h"
+
+// Backends de lista desenrollada (unrolled linked list): cada nodo ocupa
+// exactamente una línea de caché y guarda hasta UNROLLED_KEYS claves
+// ordenadas, así un recorrido sufre un fallo de caché cada 13 claves en
+// lugar de uno por clave. Un nodo lleno se parte en dos al insertar y dos
+// nodos vecinos se juntan cuando al borrar caben holgadamente en uno.
+//
+// La lista se protege igual que en linked/one_entire (--impl=unrolled, un
+// mutex) o en linked/rwl (--impl=unrolled-rw, un read-write lock).
+
+#define UNROLLED_KEYS 13
+
+// Nodo de una línea de caché: 4 + 13 * 4 + 8 = 64 bytes
+struct unrolled_node_s {
+    int count;                      // Claves usadas
+    int keys[UNROLLED_KEYS];        // Claves ordenadas
+    struct unrolled_node_s* next;
+};
+
+_Static_assert(sizeof(struct unrolled_node_s) == 64, "el nodo debe ocupar una línea de caché");
+
+// Nodo centinela sin claves: head.next es el primer nodo de la lista
+static struct unrolled_node_s head;
+static struct node_pool* node_pool;
+static pthread_mutex_t list_mutex; // --impl=unrolled
+static pthread_rwlock_t rwlock;    // --impl=unrolled-rw
+
+// Nodo donde va `value`: el primero cuya última clave es >= value, o el
+// último de la lista. Devuelve NULL si la lista está vacía.
+static struct unrolled_node_s* Locate(int value, struct unrolled_node_s** pred_pp) {
+    struct unrolled_node_s* pred_p = &head;
+    struct unrolled_node_s* curr_p = head.next;
+
+    while (curr_p != NULL && curr_p->next != NULL && curr_p->keys[curr_p->count - 1] < value) {
+        STATS_VISIT();
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+    }
+
+    *pred_pp = pred_p;
+    return curr_p;
+}
+
+// Member con el lock ya tomado
+static int MemberLocked(int value) {
+    struct unrolled_node_s* pred_p;
+    struct unrolled_node_s* curr_p = Locate(value, &pred_p);
+    if (curr_p == NULL)
+        return 0;
+
+    int i = KeysLowerBound(curr_p->keys, curr_p->count, value);
+    return i < curr_p->count && curr_p->keys[i] == value;
+}
+
+// Insert con el lock ya tomado. *spare_pp es un nodo reservado antes del
+// lock; se pone en NULL si se usó.
+static int InsertLocked(int value, struct unrolled_node_s** spare_pp) {
+    struct unrolled_node_s* pred_p;
+    struct unrolled_node_s* curr_p = Locate(value, &pred_p);
+
+    // Lista vacía: el nodo de reserva pasa a ser el primero
+    if (curr_p == NULL) {
+        struct unrolled_node_s* temp_p = *spare_pp;
+        *spare_pp = NULL;
+        temp_p->count = 1;
+        temp_p->keys[0] = value;
+        temp_p->next = NULL;
+        head.next = temp_p;
+        return 1;
+    }
+
+    int i = KeysLowerBound(curr_p->keys, curr_p->count, value);
+    if (i < curr_p->count && curr_p->keys[i] == value)
+        return 0; // El valor ya está en la lista
+
+    // Nodo lleno: mover la mitad superior al nodo de reserva
+    if (curr_p->count == UNROLLED_KEYS) {
+        struct unrolled_node_s* temp_p = *spare_pp;
+        *spare_pp = NULL;
+        int half = UNROLLED_KEYS / 2;
+        temp_p->count = UNROLLED_KEYS - half;
+        memcpy(temp_p->keys, &curr_p->keys[half], temp_p->count * sizeof(int));
+        curr_p->count = half;
+        temp_p->next = curr_p->next;
+        curr_p->next = temp_p;
+        if (i > half) {
+            curr_p = temp_p;
+            i -= half;
+        }
+    }
+
+    KeysInsertAt(curr_p->keys, &curr_p->count, i, value);
+    return 1;
+}
+
+// Delete con el lock ya tomado. Si un nodo sale de la lista se devuelve en
+// *garbage_pp para liberarlo después de soltar el lock.
+static int DeleteLocked(int value, struct unrolled_node_s** garbage_pp) {
+    struct unrolled_node_s* pred_p;
+    struct unrolled_node_s* curr_p = Locate(value, &pred_p);
+    if (curr_p == NULL)
+        return 0;
+
+    int i = KeysLowerBound(curr_p->keys, curr_p->count, value);
+    if (i == curr_p->count || curr_p->keys[i] != value)
+        return 0; // Value not found in the list
+
+    KeysRemoveAt(curr_p->keys, &curr_p->count, i);
+
+    struct unrolled_node_s* next_p = curr_p->next;
+    if (curr_p->count == 0) {
+        // Nodo vacío: desenlazarlo
+        pred_p->next = next_p;
+        *garbage_pp = curr_p;
+    } else if (next_p != NULL && curr_p->count + next_p->count <= UNROLLED_KEYS * 3 / 4) {
+        // Juntar con el siguiente dejando espacio libre para futuras inserciones
+        memcpy(&curr_p->keys[curr_p->count], next_p->keys, next_p->count * sizeof(int));
+        curr_p->count += next_p->count;
+        curr_p->next = next_p->next;
+        *garbage_pp = next_p;
+    }
+    return 1; // Successful deletion
+}
+
+// Reservar un nodo de reserva antes de tomar el lock
+static struct unrolled_node_s* AllocSpare(void) {
+    struct unrolled_node_s* spare_p = (struct unrolled_node_s*)pool_alloc(node_pool);
+    if (spare_p == NULL)
+        fprintf(stderr, "Error de asignación de memoria\n");
+    return spare_p;
+}
+
+// --impl=unrolled: un mutex para toda la lista
+
+static int Member(int value) {
+    STATS_MUTEX_LOCK(&list_mutex);
+    int result = MemberLocked(value);
+    STATS_MUTEX_UNLOCK(&list_mutex);
+    return result;
+}
+
+static int Insert(int value) {
+    struct unrolled_node_s* spare_p = AllocSpare();
+    if (spare_p == NULL)
+        return -1;
+
+    STATS_MUTEX_LOCK(&list_mutex);
+    int result = InsertLocked(value, &spare_p);
+    STATS_MUTEX_UNLOCK(&list_mutex);
+
+    pool_free(node_pool, spare_p); // No hace nada si se usó
+    return result;
+}
+
+static int Delete(int value) {
+    struct unrolled_node_s* garbage_p = NULL;
+
+    STATS_MUTEX_LOCK(&list_mutex);
+    int result = DeleteLocked(value, &garbage_p);
+    STATS_MUTEX_UNLOCK(&list_mutex);
+
+    pool_free(node_pool, garbage_p);
+    return result;
+}
+
+// --impl=unrolled-rw: un read-write lock para toda la lista
+
+#define ReadLock() \
+    STATS_LOCK(&rwlock, STATS_PROBE(pthread_rwlock_tryrdlock(&rwlock), pthread_rwlock_rdlock(&rwlock)))
+#define WriteLock() \
+    STATS_LOCK(&rwlock, STATS_PROBE(pthread_rwlock_trywrlock(&rwlock), pthread_rwlock_wrlock(&rwlock)))
+#define RwUnlock() STATS_UNLOCK(&rwlock, pthread_rwlock_unlock(&rwlock))
+
+static int MemberRw(int value) {
+    ReadLock();
+    int result = MemberLocked(value);
+    RwUnlock();
+    return result;
+}
+
+static int InsertRw(int value) {
+    struct unrolled_node_s* spare_p = AllocSpare();
+    if (spare_p == NULL)
+        return -1;
+
+    WriteLock();
+    int result = InsertLocked(value, &spare_p);
+    RwUnlock();
+
+    pool_free(node_pool, spare_p);
+    return result;
+}
+
+static int DeleteRw(int value) {
+    struct unrolled_node_s* garbage_p = NULL;
+
+    WriteLock();
+    int result = DeleteLocked(value, &garbage_p);
+    RwUnlock();
+
+    pool_free(node_pool, garbage_p);
+    return result;
+}
+
+// Inicialización del centinela y de los locks
+static void Init(void) {
+    head.count = 0;
+    head.next = NULL;
+    node_pool = pool_create(sizeof(struct unrolled_node_s));
+    pthread_mutex_init(&list_mutex, NULL);
+    pthread_rwlock_init(&rwlock, NULL);
+}
+
+// Limpiar la memoria de la lista
+static void Destroy(void) {
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+    head.next = NULL;
+    pthread_mutex_destroy(&list_mutex);
+    pthread_rwlock_destroy(&rwlock);
+}
+
+const struct list_impl list_unrolled = {
+    .name = "unrolled",
+    .description = "lista desenrollada, 13 claves por línea de caché, un mutex",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
+
+const struct list_impl list_unrolled_rw = {
+    .name = "unrolled-rw",
+    .description = "lista desenrollada, 13 claves por línea de caché, un read-write lock",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = InsertRw,
+    .Member = MemberRw,
+    .Delete = DeleteRw,
+};
@@ -0,0 +1,210 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para memcpy
+#include <pthread.h>    // Para funciones de manejo de hilos y mutex
+
+#include "list.h"
+#include "pool.h"
+#include "stats.h"
+#include "unrolled.h"
+
+// Lista desenrollada con un mutex por nodo y bloqueo mano a mano
+// (--impl=unrolled-hoh), el mismo esquema que list_one_mutex.c. Con el
+// mutex dentro, cada nodo ocupa dos líneas de caché y guarda 19 claves.
+
+#define UNROLLED_HOH_KEYS 19
+
+// Nodo de dos líneas de caché: 40 + 4 + 19 * 4 + 8 = 128 bytes
+struct unrolled_node_s {
+    pthread_mutex_t mutex;              // Mutex para sincronización
+    int count;                          // Claves usadas
+    int keys[UNROLLED_HOH_KEYS];        // Claves ordenadas
+    struct unrolled_node_s* next;
+};
+
+_Static_assert(sizeof(struct unrolled_node_s) <= 128, "el nodo debe ocupar dos líneas de caché");
+
+// Nodo centinela sin claves: head.next es el primer nodo de la lista
+static struct unrolled_node_s head;
+static struct node_pool* node_pool;
+
+// Bloquear mano a mano hasta el nodo donde va `value` (el primero cuya
+// última clave es >= value, o el último). Al volver quedan bloqueados
+// *pred_pp y el nodo devuelto (si no es NULL).
+static struct unrolled_node_s* Locate(int value, struct unrolled_node_s** pred_pp) {
+    struct unrolled_node_s* pred_p = &head;
+    STATS_MUTEX_LOCK(&(pred_p->mutex)); // Bloquear el centinela
+    struct unrolled_node_s* curr_p = pred_p->next;
+    if (curr_p != NULL)
+        STATS_MUTEX_LOCK(&(curr_p->mutex));
+
+    while (curr_p != NULL && curr_p->next != NULL && curr_p->keys[curr_p->count - 1] < value) {
+        STATS_VISIT();
+        STATS_MUTEX_UNLOCK(&(pred_p->mutex)); // Desbloquear el nodo previo
+        pred_p = curr_p;
+        curr_p = curr_p->next;
+        STATS_MUTEX_LOCK(&(curr_p->mutex)); // Bloquear el siguiente nodo
+    }
+
+    *pred_pp = pred_p;
+    return curr_p;
+}
+
+// Desbloquear los dos nodos que dejó bloqueados Locate
+static void Unlock(struct unrolled_node_s* pred_p, struct unrolled_node_s* curr_p) {
+    if (curr_p != NULL)
+        STATS_MUTEX_UNLOCK(&(curr_p->mutex));
+    STATS_MUTEX_UNLOCK(&(pred_p->mutex));
+}
+
+// Reservar e inicializar un nodo antes de tomar cualquier lock
+static struct unrolled_node_s* NewNode(void) {
+    struct unrolled_node_s* node = (struct unrolled_node_s*)pool_alloc(node_pool);
+    if (node == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        return NULL;
+    }
+    pthread_mutex_init(&(node->mutex), NULL);
+    return node;
+}
+
+// Devolver un nodo al pool
+static void FreeNode(struct unrolled_node_s* node) {
+    if (node == NULL)
+        return;
+    pthread_mutex_destroy(&(node->mutex));
+    pool_free(node_pool, node);
+}
+
+// Función para verificar si un elemento es miembro de la lista
+static int Member(int value) {
+    struct unrolled_node_s* pred_p;
+    struct unrolled_node_s* curr_p = Locate(value, &pred_p);
+
+    int found = 0;
+    if (curr_p != NULL) {
+        int i = KeysLowerBound(curr_p->keys, curr_p->count, value);
+        found = i < curr_p->count && curr_p->keys[i] == value;
+    }
+    Unlock(pred_p, curr_p);
+    return found;
+}
+
+// Función para insertar un valor (no inserta duplicados)
+static int Insert(int value) {
+    struct unrolled_node_s* spare_p = NewNode();
+    if (spare_p == NULL)
+        return -1;
+
+    struct unrolled_node_s* pred_p;
+    struct unrolled_node_s* curr_p = Locate(value, &pred_p);
+    int result = 1;
+
+    if (curr_p == NULL) {
+        // Lista vacía: el nodo de reserva pasa a ser el primero
+        spare_p->count = 1;
+        spare_p->keys[0] = value;
+        spare_p->next = NULL;
+        pred_p->next = spare_p;
+        spare_p = NULL;
+    } else {
+        int i = KeysLowerBound(curr_p->keys, curr_p->count, value);
+        if (i < curr_p->count && curr_p->keys[i] == value) {
+            result = 0; // El valor ya está en la lista
+        } else {
+            struct unrolled_node_s* target_p = curr_p;
+            if (curr_p->count == UNROLLED_HOH_KEYS) {
+                // Nodo lleno: la mitad superior pasa al nodo de reserva. Quien
+                // quiera llegar a él tiene que pasar por curr_p, que tenemos bloqueado.
+                int half = UNROLLED_HOH_KEYS / 2;
+                spare_p->count = UNROLLED_HOH_KEYS - half;
+                memcpy(spare_p->keys, &curr_p->keys[half], spare_p->count * sizeof(int));
+                curr_p->count = half;
+                spare_p->next = curr_p->next;
+                curr_p->next = spare_p;
+                if (i > half) {
+                    target_p = spare_p;
+                    i -= half;
+                }
+                spare_p = NULL;
+            }
+            KeysInsertAt(target_p->keys, &target_p->count, i, value);
+        }
+    }
+
+    Unlock(pred_p, curr_p);
+    FreeNode(spare_p); // No hace nada si se usó
+    return result;
+}
+
+// Función para eliminar un valor
+static int Delete(int value) {
+    struct unrolled_node_s* pred_p;
+    struct unrolled_node_s* curr_p = Locate(value, &pred_p);
+    struct unrolled_node_s* garbage_p = NULL;
+
+    if (curr_p == NULL) {
+        Unlock(pred_p, curr_p);
+        return 0;
+    }
+
+    int i = KeysLowerBound(curr_p->keys, curr_p->count, value);
+    if (i == curr_p->count || curr_p->keys[i] != value) {
+        Unlock(pred_p, curr_p);
+        return 0; // Value not found in the list
+    }
+
+    KeysRemoveAt(curr_p->keys, &curr_p->count, i);
+
+    struct unrolled_node_s* next_p = curr_p->next;
+    if (curr_p->count == 0) {
+        // Nodo vacío: desenlazarlo. Nadie más puede alcanzarlo, hace falta pred_p.
+        pred_p->next = next_p;
+        garbage_p = curr_p;
+    } else if (next_p != NULL) {
+        STATS_MUTEX_LOCK(&(next_p->mutex));
+        if (curr_p->count + next_p->count <= UNROLLED_HOH_KEYS * 3 / 4) {
+            // Juntar con el siguiente; para alcanzarlo hace falta curr_p
+            memcpy(&curr_p->keys[curr_p->count], next_p->keys, next_p->count * sizeof(int));
+            curr_p->count += next_p->count;
+            curr_p->next = next_p->next;
+            garbage_p = next_p;
+        }
+        STATS_MUTEX_UNLOCK(&(next_p->mutex));
+    }
+
+    Unlock(pred_p, curr_p);
+    FreeNode(garbage_p);
+    return 1; // Successful deletion
+}
+
+// Inicialización del centinela
+static void Init(void) {
+    head.count = 0;
+    head.next = NULL;
+    pthread_mutex_init(&(head.mutex), NULL);
+    node_pool = pool_create(sizeof(struct unrolled_node_s));
+}
+
+// Limpiar la memoria de la lista
+static void Destroy(void) {
+    struct unrolled_node_s* current = head.next;
+    while (current != NULL) {
+        pthread_mutex_destroy(&(current->mutex));
+        current = current->next;
+    }
+    head.next = NULL;
+    pthread_mutex_destroy(&(head.mutex));
+    pool_destroy(node_pool); // Libera todos los nodos de una vez
+}
+
+const struct list_impl list_unrolled_hoh = {
+    .name = "unrolled-hoh",
+    .description = "lista desenrollada, 19 claves en dos líneas de caché, mutex por nodo",
+    .init = Init,
+    .destroy = Destroy,
+    .thread_exit = pool_thread_exit,
+    .Insert = Insert,
+    .Member = Member,
+    .Delete = Delete,
+};
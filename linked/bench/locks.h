@@ -0,0 +1,184 @@
+#ifndef LOCKS_H
+#define LOCKS_H
+
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <stdatomic.h>  // Para operaciones atómicas
+
+#include "spin.h"
+
+// Locks de espera activa para secciones críticas muy cortas. Los backends
+// los reciben como parámetro de compilación (list_global_tmpl.h,
+// list_hoh_tmpl.h) en lugar de un pthread_mutex_t.
+//
+// ttas    test-and-test-and-set sobre un byte; sirve como lock por nodo
+// ticket  FIFO con dos contadores; todos esperan sobre la misma línea
+// mcs     cola enlazada: cada hilo espera sobre su propio nodo
+// clh     cola implícita: cada hilo espera sobre el nodo de su predecesor
+//
+// mcs y clh necesitan un nodo por hilo y por lock tomado a la vez; los
+// backends que los usan sólo tienen un lock, así que alcanza con uno por
+// hilo guardado en una variable __thread.
+//
+// Las funciones acquire devuelven distinto de 0 si el lock estaba ocupado
+// y hubo que esperar (lo cuenta stats.h).
+
+// Test-and-test-and-set: un byte, cabe dentro de cada nodo de la lista
+struct ttas_lock {
+    atomic_bool locked;
+};
+
+static inline void ttas_init(struct ttas_lock* lock) {
+    atomic_init(&lock->locked, 0);
+}
+
+static inline int ttas_acquire(struct ttas_lock* lock) {
+    unsigned spins = 0;
+    for (int contended = 0;; contended = 1) {
+        if (!atomic_exchange_explicit(&lock->locked, 1, memory_order_acquire))
+            return contended;
+        // Esperar leyendo, sin escribir la línea, hasta que parezca libre
+        while (atomic_load_explicit(&lock->locked, memory_order_relaxed))
+            spin_relax(&spins);
+    }
+}
+
+static inline void ttas_release(struct ttas_lock* lock) {
+    atomic_store_explicit(&lock->locked, 0, memory_order_release);
+}
+
+// Ticket lock: se entra en el orden en que se sacó el número
+struct ticket_lock {
+    atomic_uint next;           // Próximo número a repartir
+    atomic_uint owner;          // Número que tiene el lock
+};
+
+static inline void ticket_init(struct ticket_lock* lock) {
+    atomic_init(&lock->next, 0);
+    atomic_init(&lock->owner, 0);
+}
+
+static inline int ticket_acquire(struct ticket_lock* lock) {
+    unsigned ticket = atomic_fetch_add_explicit(&lock->next, 1, memory_order_relaxed);
+    if (atomic_load_explicit(&lock->owner, memory_order_acquire) == ticket)
+        return 0;
+    unsigned spins = 0;
+    while (atomic_load_explicit(&lock->owner, memory_order_acquire) != ticket)
+        spin_relax(&spins);
+    return 1;
+}
+
+static inline void ticket_release(struct ticket_lock* lock) {
+    // Sólo el dueño escribe owner
+    unsigned owner = atomic_load_explicit(&lock->owner, memory_order_relaxed);
+    atomic_store_explicit(&lock->owner, owner + 1, memory_order_release);
+}
+
+// MCS: cada hilo en espera encola su nodo y espera sobre él
+struct mcs_node {
+    _Atomic(struct mcs_node*) next;
+    atomic_int locked;
+} __attribute__((aligned(64)));
+
+struct mcs_lock {
+    _Atomic(struct mcs_node*) tail;
+};
+
+static inline void mcs_init(struct mcs_lock* lock) {
+    atomic_init(&lock->tail, NULL);
+}
+
+static inline int mcs_acquire(struct mcs_lock* lock, struct mcs_node* node) {
+    atomic_store_explicit(&node->next, NULL, memory_order_relaxed);
+    atomic_store_explicit(&node->locked, 1, memory_order_relaxed);
+    struct mcs_node* pred = atomic_exchange_explicit(&lock->tail, node, memory_order_acq_rel);
+    if (pred == NULL)
+        return 0; // El lock estaba libre
+
+    atomic_store_explicit(&pred->next, node, memory_order_release);
+    unsigned spins = 0;
+    while (atomic_load_explicit(&node->locked, memory_order_acquire))
+        spin_relax(&spins);
+    return 1;
+}
+
+static inline void mcs_release(struct mcs_lock* lock, struct mcs_node* node) {
+    struct mcs_node* next = atomic_load_explicit(&node->next, memory_order_acquire);
+    if (next == NULL) {
+        // Sin sucesor visible: soltar el lock si nadie se encoló
+        struct mcs_node* expected = node;
+        if (atomic_compare_exchange_strong_explicit(&lock->tail, &expected, NULL,
+                                                    memory_order_release, memory_order_relaxed))
+            return;
+        // Alguien se encoló pero todavía no se enlazó
+        unsigned spins = 0;
+        while ((next = atomic_load_explicit(&node->next, memory_order_acquire)) == NULL)
+            spin_relax(&spins);
+    }
+    atomic_store_explicit(&next->locked, 0, memory_order_release);
+}
+
+// CLH: cada hilo espera sobre el nodo del que llegó antes. Al soltar, el
+// hilo se queda con el nodo de su predecesor para la próxima vez.
+struct clh_node {
+    atomic_int locked;
+} __attribute__((aligned(64)));
+
+struct clh_lock {
+    _Atomic(struct clh_node*) tail;
+};
+
+// Nodos de un hilo para un lock CLH
+struct clh_handle {
+    struct clh_node* node;      // Nodo propio (se reserva al primer uso)
+    struct clh_node* pred;      // Nodo del predecesor mientras se tiene el lock
+};
+
+static inline struct clh_node* clh_new_node(void) {
+    struct clh_node* node = aligned_alloc(64, sizeof(struct clh_node));
+    if (node == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+    atomic_init(&node->locked, 0);
+    return node;
+}
+
+static inline void clh_init(struct clh_lock* lock) {
+    atomic_init(&lock->tail, clh_new_node());
+}
+
+// Liberar el nodo que quedó en la cola (sin hilos usando el lock)
+static inline void clh_destroy(struct clh_lock* lock) {
+    free(atomic_load(&lock->tail));
+    atomic_store(&lock->tail, NULL);
+}
+
+static inline int clh_acquire(struct clh_lock* lock, struct clh_handle* handle) {
+    if (handle->node == NULL)
+        handle->node = clh_new_node();
+    atomic_store_explicit(&handle->node->locked, 1, memory_order_relaxed);
+    struct clh_node* pred = atomic_exchange_explicit(&lock->tail, handle->node, memory_order_acq_rel);
+    int contended = 0;
+    unsigned spins = 0;
+    while (atomic_load_explicit(&pred->locked, memory_order_acquire)) {
+        contended = 1;
+        spin_relax(&spins);
+    }
+    handle->pred = pred;
+    return contended;
+}
+
+static inline void clh_release(struct clh_handle* handle) {
+    struct clh_node* node = handle->node;
+    handle->node = handle->pred; // Nadie más lo mira: el predecesor ya soltó
+    atomic_store_explicit(&node->locked, 0, memory_order_release);
+}
+
+// Liberar el nodo del hilo al terminar
+static inline void clh_thread_exit(struct clh_handle* handle) {
+    free(handle->node);
+    handle->node = NULL;
+}
+
+#endif
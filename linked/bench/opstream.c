@@ -0,0 +1,138 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para memcmp y memset
+#include <fcntl.h>      // Para open
+#include <unistd.h>     // Para close
+#include <sys/mman.h>   // Para mmap
+#include <sys/stat.h>   // Para fstat
+
+#include "opstream.h"
+
+static size_t RoundUp64(size_t n) {
+    return (n + 63) & ~(size_t)63;
+}
+
+int op_stream_alloc(struct op_stream* stream, long count) {
+    size_t size = RoundUp64((size_t)(count > 0 ? count : 1) * sizeof(struct op_entry));
+    stream->owned = aligned_alloc(64, size);
+    stream->ops = stream->owned;
+    stream->count = stream->owned != NULL ? count : 0;
+    return stream->owned != NULL ? 0 : -1;
+}
+
+void op_stream_free(struct op_stream* stream) {
+    free(stream->owned);
+    stream->owned = NULL;
+    stream->ops = NULL;
+    stream->count = 0;
+}
+
+int op_stream_generate(struct op_stream* stream, const struct workload* w, int id, int ths, long count) {
+    if (op_stream_alloc(stream, count) != 0)
+        return -1;
+
+    struct key_stream keys;
+    workload_stream_init(w, &keys, id, ths);
+    for (long i = 0; i < count; i++) {
+        stream->owned[i].op = workload_next_op(w, &keys.rng);
+        stream->owned[i].key = workload_next_key(w, &keys);
+    }
+    return 0;
+}
+
+// Escribir `size` bytes de ceros
+static int WritePadding(FILE* out, size_t size) {
+    static const char zeros[64];
+    return size == 0 || fwrite(zeros, 1, size, out) == size ? 0 : -1;
+}
+
+int op_file_save(const char* path, const struct op_stream* streams, int ths) {
+    FILE* out = fopen(path, "wb");
+    if (out == NULL)
+        return -1;
+
+    struct op_file_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, OP_FILE_MAGIC, sizeof(header.magic));
+    header.version = OP_FILE_VERSION;
+    header.threads = (uint32_t)ths;
+
+    int rc = fwrite(&header, sizeof(header), 1, out) == 1 ? 0 : -1;
+    for (int i = 0; rc == 0 && i < ths; i++) {
+        uint64_t count = (uint64_t)streams[i].count;
+        rc = fwrite(&count, sizeof(count), 1, out) == 1 ? 0 : -1;
+    }
+    size_t offset = sizeof(header) + (size_t)ths * sizeof(uint64_t);
+    if (rc == 0)
+        rc = WritePadding(out, RoundUp64(offset) - offset);
+    for (int i = 0; rc == 0 && i < ths; i++) {
+        size_t bytes = (size_t)streams[i].count * sizeof(struct op_entry);
+        if (bytes > 0 && fwrite(streams[i].ops, 1, bytes, out) != bytes)
+            rc = -1;
+        if (rc == 0)
+            rc = WritePadding(out, RoundUp64(bytes) - bytes);
+    }
+
+    if (fclose(out) != 0)
+        rc = -1;
+    return rc;
+}
+
+int op_file_open(const char* path, struct op_file* file) {
+    memset(file, 0, sizeof(*file));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(struct op_file_header)) {
+        close(fd);
+        return -1;
+    }
+    // MAP_POPULATE: las páginas ya están cargadas cuando empieza la medición
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+    file->map = map;
+    file->size = (size_t)st.st_size;
+
+    const struct op_file_header* header = map;
+    if (memcmp(header->magic, OP_FILE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != OP_FILE_VERSION || header->threads == 0)
+        goto invalid;
+
+    file->threads = (int)header->threads;
+    size_t offset = sizeof(*header) + (size_t)file->threads * sizeof(uint64_t);
+    if (offset > file->size)
+        goto invalid;
+    const uint64_t* counts = (const uint64_t*)(header + 1);
+    offset = RoundUp64(offset);
+
+    file->streams = calloc((size_t)file->threads, sizeof(struct op_stream));
+    if (file->streams == NULL)
+        goto invalid;
+    for (int i = 0; i < file->threads; i++) {
+        size_t bytes = (size_t)counts[i] * sizeof(struct op_entry);
+        if (counts[i] > (uint64_t)(file->size / sizeof(struct op_entry)) || offset + bytes > file->size)
+            goto invalid;
+        file->streams[i].ops = (const struct op_entry*)((const char*)map + offset);
+        file->streams[i].count = (long)counts[i];
+        offset += RoundUp64(bytes);
+        for (long j = 0; j < file->streams[i].count; j++) {
+            if (file->streams[i].ops[j].op < 0 || file->streams[i].ops[j].op >= OP_COUNT)
+                goto invalid;
+        }
+    }
+    return 0;
+
+invalid:
+    op_file_close(file);
+    return -1;
+}
+
+void op_file_close(struct op_file* file) {
+    free(file->streams);
+    if (file->map != NULL)
+        munmap(file->map, file->size);
+    memset(file, 0, sizeof(*file));
+}
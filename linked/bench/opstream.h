@@ -0,0 +1,66 @@
+#ifndef OPSTREAM_H
+#define OPSTREAM_H
+
+#include <stdint.h>     // Para int32_t y uint64_t
+#include <stddef.h>     // Para size_t
+
+#include "workload.h"
+
+// Flujos de operaciones pregenerados: cada hilo recibe su propio arreglo
+// de (operación, clave), alineado a línea de caché y generado antes de la
+// parte medida, así el generador aleatorio no queda dentro de la medición
+// y ningún hilo comparte líneas con otro.
+//
+// Los flujos se pueden guardar en un archivo y volver a leer con mmap para
+// repetir exactamente la misma corrida. Formato (orden de bytes de la
+// máquina):
+//
+//   struct op_file_header                  magic, versión y número de hilos
+//   uint64_t count[threads]                operaciones de cada hilo
+//   relleno hasta múltiplo de 64 bytes
+//   por cada hilo: struct op_entry[count], relleno hasta múltiplo de 64
+
+#define OP_FILE_MAGIC "LSTOPS\0\0"
+#define OP_FILE_VERSION 1
+
+struct op_entry {
+    int32_t key;
+    int32_t op;                 // enum op_type
+};
+
+struct op_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t threads;
+};
+
+// Flujo de un hilo
+struct op_stream {
+    const struct op_entry* ops;
+    long count;
+    struct op_entry* owned;     // Memoria propia (NULL si apunta a un archivo)
+};
+
+// Archivo de flujos abierto con mmap
+struct op_file {
+    void* map;
+    size_t size;
+    int threads;
+    struct op_stream* streams;  // Uno por hilo, apuntando dentro de map
+};
+
+// Reservar un flujo de `count` operaciones (alineado a 64). 0 si se pudo.
+int op_stream_alloc(struct op_stream* stream, long count);
+void op_stream_free(struct op_stream* stream);
+
+// Generar `count` operaciones de la mezcla de `w` para el hilo `id` de `ths`
+int op_stream_generate(struct op_stream* stream, const struct workload* w, int id, int ths, long count);
+
+// Guardar los flujos de `ths` hilos. 0 si se pudo escribir.
+int op_file_save(const char* path, const struct op_stream* streams, int ths);
+
+// Abrir un archivo de flujos con mmap. 0 si es válido.
+int op_file_open(const char* path, struct op_file* file);
+void op_file_close(struct op_file* file);
+
+#endif
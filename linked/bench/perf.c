@@ -0,0 +1,138 @@
+#include <string.h>     // Para memset
+#include <unistd.h>     // Para syscall, read y close
+#include <sys/ioctl.h>  // Para ioctl
+#include <sys/syscall.h>        // Para SYS_perf_event_open
+#include <linux/perf_event.h>   // Para struct perf_event_attr
+
+#include "perf.h"
+
+// Descripción de cada evento
+struct perf_event_desc {
+    const char* name;
+    uint32_t type;
+    uint64_t config;
+};
+
+#define CACHE_MISS(cache) \
+    ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static struct perf_event_desc events[PERF_EVENT_COUNT] = {
+    [PERF_CYCLES]        = {"ciclos",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    [PERF_INSTRUCTIONS]  = {"instrucciones", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    [PERF_L1D_MISSES]    = {"fallos L1d",    PERF_TYPE_HW_CACHE, CACHE_MISS(PERF_COUNT_HW_CACHE_L1D)},
+    [PERF_LLC_MISSES]    = {"fallos LLC",    PERF_TYPE_HW_CACHE, CACHE_MISS(PERF_COUNT_HW_CACHE_LL)},
+    [PERF_BRANCH_MISSES] = {"fallos salto",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    [PERF_RAW]           = {"crudo",         PERF_TYPE_RAW,      0},
+};
+
+static int enabled = 0;
+static unsigned available = 0;  // Bit i: el evento i se pudo abrir en perf_setup
+
+// Abrir un evento para el hilo actual, detenido y sólo en modo usuario
+static int OpenEvent(int id) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = events[id].type;
+    attr.config = events[id].config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // Con más eventos que contadores el kernel los multiplexa: leer los
+    // tiempos para escalar
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+int perf_setup(uint64_t raw_config) {
+    events[PERF_RAW].config = raw_config;
+    available = 0;
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (i == PERF_RAW && raw_config == 0)
+            continue;
+        int fd = OpenEvent(i);
+        if (fd >= 0) {
+            available |= 1u << i;
+            close(fd);
+        }
+    }
+    enabled = available != 0;
+    return enabled ? 0 : -1;
+}
+
+int perf_enabled(void) {
+    return enabled;
+}
+
+void perf_thread_open(struct perf_session* session) {
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        session->fd[i] = -1;
+        if (enabled && (available & (1u << i)))
+            session->fd[i] = OpenEvent(i);
+    }
+}
+
+void perf_thread_start(struct perf_session* session) {
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (session->fd[i] >= 0) {
+            ioctl(session->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(session->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+void perf_thread_reset(struct perf_session* session) {
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (session->fd[i] >= 0)
+            ioctl(session->fd[i], PERF_EVENT_IOC_RESET, 0);
+    }
+}
+
+void perf_thread_end(struct perf_session* session, struct perf_counts* counts) {
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (session->fd[i] >= 0)
+            ioctl(session->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (session->fd[i] < 0)
+            continue;
+        uint64_t buf[3]; // valor, tiempo habilitado, tiempo contando
+        if (read(session->fd[i], buf, sizeof(buf)) == (ssize_t)sizeof(buf) && buf[2] > 0) {
+            double scale = (double)buf[1] / buf[2];
+            counts->value[i] += (uint64_t)(buf[0] * scale);
+            counts->valid |= 1u << i;
+        }
+        close(session->fd[i]);
+        session->fd[i] = -1;
+    }
+}
+
+void perf_counts_reset(struct perf_counts* counts) {
+    memset(counts, 0, sizeof(*counts));
+}
+
+void perf_counts_merge(struct perf_counts* into, const struct perf_counts* from) {
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        into->value[i] += from->value[i];
+    }
+    into->valid |= from->valid;
+}
+
+void perf_report(FILE* out, const struct perf_counts* counts, uint64_t ops) {
+    const char* sep = "    Contadores por op: ";
+    for (int i = 0; i < PERF_EVENT_COUNT; i++) {
+        if (i == PERF_RAW && events[PERF_RAW].config == 0)
+            continue;
+        if ((counts->valid & (1u << i)) && ops > 0)
+            fprintf(out, "%s%s %.2f", sep, events[i].name, (double)counts->value[i] / ops);
+        else
+            fprintf(out, "%s%s n/d", sep, events[i].name);
+        sep = ", ";
+    }
+    fprintf(out, "\n");
+    // IPC: lo que más cambia entre disposiciones de nodos
+    if ((counts->valid & (1u << PERF_CYCLES)) && (counts->valid & (1u << PERF_INSTRUCTIONS)) &&
+        counts->value[PERF_CYCLES] > 0)
+        fprintf(out, "    IPC: %.2f\n",
+                (double)counts->value[PERF_INSTRUCTIONS] / counts->value[PERF_CYCLES]);
+}
@@ -0,0 +1,64 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>     // Para uint64_t
+#include <stdio.h>      // Para FILE
+
+// Contadores de hardware por hilo con perf_event_open (--perf). Cada hilo
+// de trabajo abre sus contadores detenidos antes de la barrera de inicio,
+// sólo en modo usuario y sólo para sí mismo, los arranca al empezar a medir
+// y los lee al terminar. Los eventos que la CPU o el kernel no ofrecen
+// quedan sin valor y se informan como n/d.
+//
+// El traspaso de líneas entre núcleos (HITM) no tiene un evento genérico;
+// con --perf-raw=CÓDIGO se cuenta además un evento crudo del modelo de CPU.
+
+enum perf_event_id {
+    PERF_CYCLES,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_RAW,
+    PERF_EVENT_COUNT
+};
+
+// Cuentas de un hilo (o la suma de varios) en una fase
+struct perf_counts {
+    uint64_t value[PERF_EVENT_COUNT];
+    unsigned valid;             // Bit i: value[i] se pudo medir
+};
+
+// Descriptores abiertos por un hilo
+struct perf_session {
+    int fd[PERF_EVENT_COUNT];
+};
+
+// Activar los contadores. raw_config es el código del evento crudo (0 =
+// ninguno). Devuelve 0 si al menos uno de los eventos se puede abrir.
+int perf_setup(uint64_t raw_config);
+
+// 1 si --perf está activo y hay contadores
+int perf_enabled(void);
+
+// Abrir los contadores del hilo actual, detenidos. Las llamadas al sistema
+// quedan fuera del intervalo medido.
+void perf_thread_open(struct perf_session* session);
+
+// Ponerlos en cero y arrancarlos
+void perf_thread_start(struct perf_session* session);
+
+// Poner en cero los contadores abiertos (fin del calentamiento)
+void perf_thread_reset(struct perf_session* session);
+
+// Detenerlos, sumar lo contado a `counts` y cerrarlos
+void perf_thread_end(struct perf_session* session, struct perf_counts* counts);
+
+// Vaciar / acumular cuentas
+void perf_counts_reset(struct perf_counts* counts);
+void perf_counts_merge(struct perf_counts* into, const struct perf_counts* from);
+
+// Imprimir las cuentas divididas por `ops` operaciones
+void perf_report(FILE* out, const struct perf_counts* counts, uint64_t ops);
+
+#endif
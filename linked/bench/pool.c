@@ -0,0 +1,263 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para el mutex de cada pool
+
+#include "pool.h"
+
+#define CACHE_LINE 64
+#define SLAB_SIZE (64 * 1024)   // Bytes por slab
+#define POOL_BATCH 256          // Objetos que se mueven de una vez entre caché y depósito
+#define POOL_MAX_POOLS 64       // Pools vivos a la vez
+
+// Objeto libre: el enlace se guarda en el propio objeto
+struct free_obj {
+    struct free_obj* next;
+};
+
+// Caché de un hilo en un pool
+struct pool_cache {
+    struct free_obj* free_list;
+    size_t free_count;
+    char* bump;             // Siguiente objeto sin usar del slab actual
+    char* bump_end;
+    int orphan;             // 1 si el hilo dueño terminó y otro puede adoptarla
+    struct pool_cache* next_cache;
+} __attribute__((aligned(CACHE_LINE)));
+
+// Slab reservado por el pool
+struct slab {
+    struct slab* next;
+};
+
+struct node_pool {
+    int id;                     // Posición en la tabla de pools vivos
+    unsigned long serial;       // Distingue este pool de otro que reusó el id
+    size_t object_size;
+
+    pthread_mutex_t mutex;      // Protege lo de abajo
+    struct free_obj* depot;     // Objetos libres compartidos entre hilos
+    size_t depot_count;
+    struct slab* slabs;
+    struct pool_cache* caches;
+};
+
+// Tabla de pools vivos, para encontrar las cachés del hilo en pool_thread_exit
+static pthread_mutex_t registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct node_pool* registry[POOL_MAX_POOLS];
+static unsigned long next_serial = 1;
+
+// Caché del hilo actual en cada pool, válida si el serial coincide
+static __thread struct {
+    unsigned long serial;
+    struct pool_cache* cache;
+} tls[POOL_MAX_POOLS];
+
+// Tamaño de objeto que nunca cruza una línea de caché: potencia de dos hasta
+// 64 bytes, múltiplo de 64 por encima
+static size_t RoundSize(size_t size) {
+    if (size < sizeof(struct free_obj))
+        size = sizeof(struct free_obj);
+    if (size >= CACHE_LINE)
+        return (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    size_t rounded = sizeof(struct free_obj);
+    while (rounded < size)
+        rounded *= 2;
+    return rounded;
+}
+
+// Crear un pool de objetos de `object_size` bytes
+struct node_pool* pool_create(size_t object_size) {
+    struct node_pool* pool = calloc(1, sizeof(struct node_pool));
+    if (pool == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+    pool->object_size = RoundSize(object_size);
+    if (pool->object_size > SLAB_SIZE - CACHE_LINE) {
+        fprintf(stderr, "pool: objetos de %zu bytes no caben en un slab\n", object_size);
+        exit(EXIT_FAILURE);
+    }
+    pthread_mutex_init(&pool->mutex, NULL);
+
+    pthread_mutex_lock(&registry_mutex);
+    pool->id = -1;
+    for (int i = 0; i < POOL_MAX_POOLS; i++) {
+        if (registry[i] == NULL) {
+            registry[i] = pool;
+            pool->id = i;
+            break;
+        }
+    }
+    pool->serial = next_serial++;
+    pthread_mutex_unlock(&registry_mutex);
+
+    if (pool->id < 0) {
+        fprintf(stderr, "pool: más de %d pools a la vez\n", POOL_MAX_POOLS);
+        exit(EXIT_FAILURE);
+    }
+    return pool;
+}
+
+// Liberar todos los slabs del pool
+void pool_destroy(struct node_pool* pool) {
+    pthread_mutex_lock(&registry_mutex);
+    registry[pool->id] = NULL;
+    pthread_mutex_unlock(&registry_mutex);
+
+    struct slab* slab = pool->slabs;
+    while (slab != NULL) {
+        struct slab* next = slab->next;
+        free(slab);
+        slab = next;
+    }
+
+    struct pool_cache* cache = pool->caches;
+    while (cache != NULL) {
+        struct pool_cache* next = cache->next_cache;
+        free(cache);
+        cache = next;
+    }
+
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool);
+}
+
+// Obtener (o crear / adoptar) la caché del hilo actual en el pool
+static struct pool_cache* AttachCache(struct node_pool* pool) {
+    struct pool_cache* cache;
+
+    pthread_mutex_lock(&pool->mutex);
+    for (cache = pool->caches; cache != NULL; cache = cache->next_cache) {
+        if (cache->orphan)
+            break;
+    }
+    if (cache == NULL) {
+        cache = aligned_alloc(CACHE_LINE, sizeof(struct pool_cache));
+        if (cache == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            exit(EXIT_FAILURE);
+        }
+        cache->free_list = NULL;
+        cache->free_count = 0;
+        cache->bump = cache->bump_end = NULL;
+        cache->next_cache = pool->caches;
+        pool->caches = cache;
+    }
+    cache->orphan = 0;
+    pthread_mutex_unlock(&pool->mutex);
+
+    tls[pool->id].serial = pool->serial;
+    tls[pool->id].cache = cache;
+    return cache;
+}
+
+static inline struct pool_cache* GetCache(struct node_pool* pool) {
+    if (tls[pool->id].serial == pool->serial)
+        return tls[pool->id].cache;
+    return AttachCache(pool);
+}
+
+// Rellenar la caché desde el depósito o con un slab nuevo
+static void Refill(struct node_pool* pool, struct pool_cache* cache) {
+    pthread_mutex_lock(&pool->mutex);
+
+    if (pool->depot != NULL) {
+        // Tomar hasta POOL_BATCH objetos del depósito
+        struct free_obj* first = pool->depot;
+        struct free_obj* last = first;
+        size_t n = 1;
+        while (n < POOL_BATCH && last->next != NULL) {
+            last = last->next;
+            n++;
+        }
+        pool->depot = last->next;
+        pool->depot_count -= n;
+        last->next = cache->free_list;
+        cache->free_list = first;
+        cache->free_count += n;
+    } else {
+        struct slab* slab = aligned_alloc(CACHE_LINE, SLAB_SIZE);
+        if (slab == NULL) {
+            pthread_mutex_unlock(&pool->mutex);
+            return; // pool_alloc devolverá NULL
+        }
+        slab->next = pool->slabs;
+        pool->slabs = slab;
+        // Los objetos empiezan en la primera línea de caché después del encabezado
+        cache->bump = (char*)slab + CACHE_LINE;
+        cache->bump_end = (char*)slab + SLAB_SIZE;
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+// Reservar un objeto
+void* pool_alloc(struct node_pool* pool) {
+    struct pool_cache* cache = GetCache(pool);
+
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (cache->free_list != NULL) {
+            struct free_obj* obj = cache->free_list;
+            cache->free_list = obj->next;
+            cache->free_count--;
+            return obj;
+        }
+        if (cache->bump + pool->object_size <= cache->bump_end) {
+            void* obj = cache->bump;
+            cache->bump += pool->object_size;
+            return obj;
+        }
+        Refill(pool, cache);
+    }
+    return NULL;
+}
+
+// Pasar POOL_BATCH objetos de la caché al depósito
+static void Spill(struct node_pool* pool, struct pool_cache* cache, size_t n) {
+    struct free_obj* first = cache->free_list;
+    struct free_obj* last = first;
+    for (size_t i = 1; i < n; i++) {
+        last = last->next;
+    }
+    cache->free_list = last->next;
+    cache->free_count -= n;
+
+    pthread_mutex_lock(&pool->mutex);
+    last->next = pool->depot;
+    pool->depot = first;
+    pool->depot_count += n;
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+// Devolver un objeto
+void pool_free(struct node_pool* pool, void* object) {
+    if (object == NULL)
+        return;
+    struct pool_cache* cache = GetCache(pool);
+    struct free_obj* obj = (struct free_obj*)object;
+    obj->next = cache->free_list;
+    cache->free_list = obj;
+    cache->free_count++;
+
+    // Que una caché no acapare lo que otros hilos necesitan
+    if (cache->free_count >= 2 * POOL_BATCH)
+        Spill(pool, cache, POOL_BATCH);
+}
+
+// Devolver al depósito lo que tiene en caché el hilo actual
+void pool_thread_exit(void) {
+    pthread_mutex_lock(&registry_mutex);
+    for (int i = 0; i < POOL_MAX_POOLS; i++) {
+        struct node_pool* pool = registry[i];
+        if (pool == NULL || tls[i].serial != pool->serial)
+            continue;
+        struct pool_cache* cache = tls[i].cache;
+        if (cache->free_count > 0)
+            Spill(pool, cache, cache->free_count);
+        pthread_mutex_lock(&pool->mutex);
+        cache->orphan = 1; // El resto del slab actual queda para otro hilo
+        pthread_mutex_unlock(&pool->mutex);
+        tls[i].serial = 0;
+    }
+    pthread_mutex_unlock(&registry_mutex);
+}
@@ -0,0 +1,31 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stddef.h>     // Para size_t
+
+// Pool de nodos de tamaño fijo con una caché por hilo.
+//
+// La memoria se pide en bloques (slabs) alineados a línea de caché y se
+// reparte en objetos que nunca cruzan una línea de caché. Cada hilo
+// reserva y recicla objetos en su propia lista libre sin tomar locks; sólo
+// se toma el mutex del pool para pedir un slab nuevo o para pasar objetos
+// entre hilos cuando una caché se vacía o crece demasiado. Los objetos
+// liberados siguen siendo memoria del pool hasta pool_destroy.
+
+struct node_pool;
+
+// Crear un pool de objetos de `object_size` bytes
+struct node_pool* pool_create(size_t object_size);
+
+// Liberar todos los slabs del pool (ningún hilo debe estar usándolo)
+void pool_destroy(struct node_pool* pool);
+
+// Reservar / devolver un objeto
+void* pool_alloc(struct node_pool* pool);
+void pool_free(struct node_pool* pool, void* object);
+
+// Devolver al pool lo que tiene en caché el hilo actual, en todos los pools.
+// Se llama al terminar cada hilo de trabajo.
+void pool_thread_exit(void);
+
+#endif
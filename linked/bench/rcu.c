@@ -0,0 +1,194 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <pthread.h>    // Para el hilo recolector
+#include <time.h>       // Para clock_gettime
+#include <unistd.h>     // Para syscall
+#include <sys/syscall.h>        // Para SYS_membarrier
+#include <linux/membarrier.h>   // Para MEMBARRIER_CMD_*
+
+#include "pool.h"
+#include "rcu.h"
+#include "spin.h"
+
+#define RCU_BATCH 256           // Nodos pendientes que despiertan al recolector
+#define RCU_PERIOD_MS 10        // Espera máxima del recolector entre periodos de gracia
+
+// Nodo pendiente de liberar
+struct rcu_deferred {
+    void* ptr;
+    void (*free_fn)(void*);
+};
+
+// Nodos pendientes
+struct rcu_batch {
+    struct rcu_deferred* items;
+    size_t count;
+    size_t capacity;
+};
+
+// Empieza en 1: un contador en 0 significa "fuera de una sección"
+_Atomic unsigned long rcu_gp_ctr = 1;
+int rcu_use_membarrier = 0;
+__thread struct rcu_reader* rcu_self = NULL;
+
+static struct rcu_reader readers[RCU_MAX_THREADS];
+static atomic_int max_readers = 0;  // Registros usados alguna vez
+
+// Cola del recolector
+static pthread_mutex_t defer_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t defer_cond = PTHREAD_COND_INITIALIZER;
+static struct rcu_batch pending;
+static int stopping = 0;
+static pthread_t reclaimer;
+
+// Barrera completa en todos los hilos del proceso
+static void MasterBarrier(void) {
+    if (rcu_use_membarrier)
+        syscall(SYS_membarrier, MEMBARRIER_CMD_PRIVATE_EXPEDITED, 0, 0);
+    else
+        atomic_thread_fence(memory_order_seq_cst);
+}
+
+// Esperar a que todo lector que entró antes de empezar haya salido
+static void Synchronize(void) {
+    // Los desenlaces ya hechos deben verse antes de mirar los contadores
+    MasterBarrier();
+    unsigned long gp = atomic_fetch_add(&rcu_gp_ctr, 1) + 1;
+
+    int n = atomic_load(&max_readers);
+    for (int i = 0; i < n; i++) {
+        unsigned spins = 0;
+        for (;;) {
+            unsigned long ctr = atomic_load_explicit(&readers[i].ctr, memory_order_acquire);
+            if (ctr == 0 || ctr >= gp)
+                break; // Fuera de una sección o entró después del desenlace
+            spin_relax(&spins);
+        }
+    }
+
+    MasterBarrier();
+}
+
+static void BatchPush(struct rcu_batch* batch, void* ptr, void (*free_fn)(void*)) {
+    if (batch->count == batch->capacity) {
+        size_t capacity = batch->capacity ? 2 * batch->capacity : RCU_BATCH;
+        struct rcu_deferred* items = realloc(batch->items, capacity * sizeof(*items));
+        if (items == NULL) {
+            fprintf(stderr, "Error de asignación de memoria\n");
+            exit(EXIT_FAILURE);
+        }
+        batch->items = items;
+        batch->capacity = capacity;
+    }
+    batch->items[batch->count].ptr = ptr;
+    batch->items[batch->count].free_fn = free_fn;
+    batch->count++;
+}
+
+// Hilo recolector: toma los pendientes, espera un periodo de gracia y los libera
+static void* Reclaimer(void* arg) {
+    (void)arg;
+    struct rcu_batch batch = {0};
+
+    pthread_mutex_lock(&defer_mutex);
+    for (;;) {
+        if (pending.count < RCU_BATCH && !stopping) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_nsec += RCU_PERIOD_MS * 1000000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&defer_cond, &defer_mutex, &deadline);
+        }
+        if (pending.count == 0) {
+            if (stopping)
+                break;
+            continue;
+        }
+
+        // Intercambiar la cola con el lote vacío y soltar el mutex
+        struct rcu_batch full = pending;
+        pending = batch;
+        pthread_mutex_unlock(&defer_mutex);
+
+        Synchronize();
+        for (size_t i = 0; i < full.count; i++) {
+            full.items[i].free_fn(full.items[i].ptr);
+        }
+        full.count = 0;
+        batch = full;
+
+        pthread_mutex_lock(&defer_mutex);
+    }
+    pthread_mutex_unlock(&defer_mutex);
+
+    free(batch.items);
+    // Lo liberado quedó en la caché de este hilo
+    pool_thread_exit();
+    return NULL;
+}
+
+// Arrancar el hilo recolector
+void rcu_start(void) {
+    rcu_use_membarrier =
+        syscall(SYS_membarrier, MEMBARRIER_CMD_REGISTER_PRIVATE_EXPEDITED, 0, 0) == 0;
+    stopping = 0;
+    if (pthread_create(&reclaimer, NULL, Reclaimer, NULL) != 0) {
+        fprintf(stderr, "rcu: no se pudo crear el hilo recolector\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+// Detener el recolector después de liberar todo lo pendiente
+void rcu_stop(void) {
+    pthread_mutex_lock(&defer_mutex);
+    stopping = 1;
+    pthread_cond_signal(&defer_cond);
+    pthread_mutex_unlock(&defer_mutex);
+    pthread_join(reclaimer, NULL);
+
+    free(pending.items);
+    pending.items = NULL;
+    pending.count = pending.capacity = 0;
+}
+
+// Registrar el hilo actual
+void rcu_thread_init(void) {
+    if (rcu_self != NULL)
+        return;
+
+    for (int i = 0; i < RCU_MAX_THREADS; i++) {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&readers[i].in_use, &expected, 1)) {
+            rcu_self = &readers[i];
+            atomic_store(&rcu_self->ctr, 0);
+            int n = atomic_load(&max_readers);
+            while (n < i + 1 && !atomic_compare_exchange_weak(&max_readers, &n, i + 1))
+                ;
+            return;
+        }
+    }
+
+    fprintf(stderr, "rcu: más de %d hilos registrados\n", RCU_MAX_THREADS);
+    exit(EXIT_FAILURE);
+}
+
+// Dar de baja el hilo actual
+void rcu_thread_exit(void) {
+    if (rcu_self == NULL)
+        return;
+    atomic_store(&rcu_self->ctr, 0);
+    atomic_store(&rcu_self->in_use, 0);
+    rcu_self = NULL;
+}
+
+// Encolar un nodo ya desenlazado para el recolector
+void rcu_defer(void* ptr, void (*free_fn)(void*)) {
+    pthread_mutex_lock(&defer_mutex);
+    BatchPush(&pending, ptr, free_fn);
+    if (pending.count == RCU_BATCH)
+        pthread_cond_signal(&defer_cond);
+    pthread_mutex_unlock(&defer_mutex);
+}
@@ -0,0 +1,62 @@
+#ifndef RCU_H
+#define RCU_H
+
+#include <stdatomic.h>  // Para el contador de cada lector
+
+// Read-copy-update en espacio de usuario, con un hilo recolector.
+//
+// Los lectores delimitan su recorrido con rcu_read_lock y rcu_read_unlock,
+// que sólo escriben en el contador propio del hilo (en su propia línea de
+// caché). Los escritores desenlazan un nodo y lo entregan a rcu_defer; el
+// hilo recolector junta los nodos pendientes, espera un periodo de gracia
+// (hasta que todo lector que estaba dentro de una sección salió de ella) y
+// recién entonces los libera. Así Delete nunca espera a los lectores.
+//
+// Si el kernel ofrece membarrier(2) la barrera completa del lector se
+// reemplaza por una del compilador y el recolector la impone con la llamada
+// al sistema; si no, el lector usa una barrera seq_cst.
+//
+// Cada hilo lector debe llamar a rcu_thread_init antes de su primera
+// operación y a rcu_thread_exit al terminar.
+
+#define RCU_MAX_THREADS 256
+
+// Estado de un lector, en su propia línea de caché
+struct rcu_reader {
+    // Periodo de gracia observado al entrar, 0 fuera de una sección
+    _Atomic unsigned long ctr;
+    atomic_int in_use;
+} __attribute__((aligned(64)));
+
+extern _Atomic unsigned long rcu_gp_ctr;
+extern int rcu_use_membarrier;
+extern __thread struct rcu_reader* rcu_self;
+
+// Arrancar / detener el hilo recolector. rcu_stop libera todo lo pendiente
+// y sólo debe llamarse cuando ningún hilo está dentro de una sección.
+void rcu_start(void);
+void rcu_stop(void);
+
+// Registrar / dar de baja el hilo actual como lector
+void rcu_thread_init(void);
+void rcu_thread_exit(void);
+
+// Liberar `ptr` con `free_fn` después de un periodo de gracia
+void rcu_defer(void* ptr, void (*free_fn)(void*));
+
+// Sección crítica de lectura: no se puede anidar
+static inline void rcu_read_lock(void) {
+    unsigned long gp = atomic_load_explicit(&rcu_gp_ctr, memory_order_relaxed);
+    atomic_store_explicit(&rcu_self->ctr, gp, memory_order_relaxed);
+    // El anuncio debe verse antes de leer cualquier puntero compartido
+    if (rcu_use_membarrier)
+        atomic_signal_fence(memory_order_seq_cst);
+    else
+        atomic_thread_fence(memory_order_seq_cst);
+}
+
+static inline void rcu_read_unlock(void) {
+    atomic_store_explicit(&rcu_self->ctr, 0, memory_order_release);
+}
+
+#endif
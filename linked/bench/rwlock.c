@@ -0,0 +1,191 @@
+#define _GNU_SOURCE     // Para pthread_rwlockattr_setkind_np
+#include <stdlib.h>     // Para funciones de manejo de memoria
+
+#include "rwlock.h"
+#include "spin.h"
+#include "stats.h"
+
+// Bits del escritor en rin del lock phase-fair
+#define PF_RINC  0x100  // Incremento de un lector
+#define PF_WBITS 0x3    // Escritor presente y fase
+#define PF_PRES  0x2    // Hay un escritor presente
+#define PF_PHID  0x1    // Fase del escritor
+
+// Contador de lectores del hilo actual en los locks sesgados
+static __thread int reader_slot = -1;
+static atomic_uint next_reader_slot = 0;
+
+static inline struct rw_reader_slot* MySlot(struct rw_lock* lock) {
+    if (reader_slot < 0)
+        reader_slot = atomic_fetch_add(&next_reader_slot, 1) % RW_READER_SLOTS;
+    return &lock->biased.slots[reader_slot];
+}
+
+const char* rw_policy_name(enum rw_policy policy) {
+    switch (policy) {
+    case RW_PTHREAD:        return "pthread";
+    case RW_PTHREAD_WRITER: return "writer";
+    case RW_BIASED:         return "biased";
+    case RW_PHASE_FAIR:     return "phase-fair";
+    }
+    return "?";
+}
+
+int rw_init(struct rw_lock* lock, enum rw_policy policy) {
+    lock->policy = policy;
+    switch (policy) {
+    case RW_PTHREAD:
+        return pthread_rwlock_init(&lock->rwlock, NULL);
+    case RW_PTHREAD_WRITER: {
+        pthread_rwlockattr_t attr;
+        pthread_rwlockattr_init(&attr);
+        pthread_rwlockattr_setkind_np(&attr, PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP);
+        int rc = pthread_rwlock_init(&lock->rwlock, &attr);
+        pthread_rwlockattr_destroy(&attr);
+        return rc;
+    }
+    case RW_BIASED:
+        lock->biased.slots = aligned_alloc(64, RW_READER_SLOTS * sizeof(struct rw_reader_slot));
+        if (lock->biased.slots == NULL)
+            return -1;
+        for (int i = 0; i < RW_READER_SLOTS; i++)
+            atomic_init(&lock->biased.slots[i].readers, 0);
+        atomic_init(&lock->biased.writer, 0);
+        return pthread_mutex_init(&lock->biased.writers, NULL);
+    case RW_PHASE_FAIR:
+        atomic_init(&lock->pf.rin, 0);
+        atomic_init(&lock->pf.rout, 0);
+        atomic_init(&lock->pf.win, 0);
+        atomic_init(&lock->pf.wout, 0);
+        return 0;
+    }
+    return -1;
+}
+
+void rw_destroy(struct rw_lock* lock) {
+    switch (lock->policy) {
+    case RW_PTHREAD:
+    case RW_PTHREAD_WRITER:
+        pthread_rwlock_destroy(&lock->rwlock);
+        break;
+    case RW_BIASED:
+        pthread_mutex_destroy(&lock->biased.writers);
+        free(lock->biased.slots);
+        lock->biased.slots = NULL;
+        break;
+    case RW_PHASE_FAIR:
+        break;
+    }
+}
+
+int rw_rdlock(struct rw_lock* lock) {
+    unsigned spins = 0;
+    int contended = 0;
+    switch (lock->policy) {
+    case RW_PTHREAD:
+    case RW_PTHREAD_WRITER:
+        contended = STATS_PROBE(pthread_rwlock_tryrdlock(&lock->rwlock),
+                                pthread_rwlock_rdlock(&lock->rwlock));
+        break;
+    case RW_BIASED: {
+        struct rw_reader_slot* slot = MySlot(lock);
+        for (;;) {
+            // Anunciar la lectura y después mirar la bandera; el escritor
+            // hace lo mismo en el orden inverso (ambos seq_cst)
+            atomic_fetch_add(&slot->readers, 1);
+            if (!atomic_load(&lock->biased.writer))
+                return contended;
+            // Hay un escritor: retirarse y esperar a que termine
+            contended = 1;
+            atomic_fetch_sub_explicit(&slot->readers, 1, memory_order_release);
+            while (atomic_load_explicit(&lock->biased.writer, memory_order_relaxed))
+                spin_relax(&spins);
+        }
+    }
+    case RW_PHASE_FAIR: {
+        // Si hay un escritor, esperar a que cambien sus bits (fin de su fase)
+        unsigned w = atomic_fetch_add_explicit(&lock->pf.rin, PF_RINC, memory_order_acquire) & PF_WBITS;
+        if (w != 0) {
+            contended = 1;
+            while ((atomic_load_explicit(&lock->pf.rin, memory_order_acquire) & PF_WBITS) == w)
+                spin_relax(&spins);
+        }
+        break;
+    }
+    }
+    return contended;
+}
+
+void rw_rdunlock(struct rw_lock* lock) {
+    switch (lock->policy) {
+    case RW_PTHREAD:
+    case RW_PTHREAD_WRITER:
+        pthread_rwlock_unlock(&lock->rwlock);
+        break;
+    case RW_BIASED:
+        atomic_fetch_sub_explicit(&MySlot(lock)->readers, 1, memory_order_release);
+        break;
+    case RW_PHASE_FAIR:
+        atomic_fetch_add_explicit(&lock->pf.rout, PF_RINC, memory_order_release);
+        break;
+    }
+}
+
+int rw_wrlock(struct rw_lock* lock) {
+    unsigned spins = 0;
+    int contended = 0;
+    switch (lock->policy) {
+    case RW_PTHREAD:
+    case RW_PTHREAD_WRITER:
+        contended = STATS_PROBE(pthread_rwlock_trywrlock(&lock->rwlock),
+                                pthread_rwlock_wrlock(&lock->rwlock));
+        break;
+    case RW_BIASED:
+        contended = STATS_PROBE(pthread_mutex_trylock(&lock->biased.writers),
+                                pthread_mutex_lock(&lock->biased.writers));
+        atomic_store(&lock->biased.writer, 1);
+        // Esperar a que salgan los lectores que entraron antes de la bandera
+        for (int i = 0; i < RW_READER_SLOTS; i++) {
+            while (atomic_load(&lock->biased.slots[i].readers) != 0) {
+                contended = 1;
+                spin_relax(&spins);
+            }
+        }
+        break;
+    case RW_PHASE_FAIR: {
+        // Turno entre escritores
+        unsigned ticket = atomic_fetch_add_explicit(&lock->pf.win, 1, memory_order_relaxed);
+        while (atomic_load_explicit(&lock->pf.wout, memory_order_acquire) != ticket) {
+            contended = 1;
+            spin_relax(&spins);
+        }
+        // Bloquear a los lectores nuevos y esperar a los que ya entraron
+        unsigned w = PF_PRES | (ticket & PF_PHID);
+        unsigned readers = atomic_fetch_add_explicit(&lock->pf.rin, w, memory_order_acq_rel);
+        while (atomic_load_explicit(&lock->pf.rout, memory_order_acquire) != readers) {
+            contended = 1;
+            spin_relax(&spins);
+        }
+        break;
+    }
+    }
+    return contended;
+}
+
+void rw_wrunlock(struct rw_lock* lock) {
+    switch (lock->policy) {
+    case RW_PTHREAD:
+    case RW_PTHREAD_WRITER:
+        pthread_rwlock_unlock(&lock->rwlock);
+        break;
+    case RW_BIASED:
+        atomic_store_explicit(&lock->biased.writer, 0, memory_order_release);
+        pthread_mutex_unlock(&lock->biased.writers);
+        break;
+    case RW_PHASE_FAIR:
+        // Liberar a los lectores en espera y pasar el turno al siguiente escritor
+        atomic_fetch_and_explicit(&lock->pf.rin, ~(unsigned)PF_WBITS, memory_order_release);
+        atomic_fetch_add_explicit(&lock->pf.wout, 1, memory_order_release);
+        break;
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#include <pthread.h>    // Para pthread_rwlock_t y pthread_mutex_t
+#include <stdatomic.h>  // Para los contadores atómicos
+
+// Read-write locks con distintas políticas de preferencia.
+//
+// RW_PTHREAD         pthread_rwlock_t por defecto; en glibc prefiere a los
+//                    lectores y una ráfaga de búsquedas puede dejar sin turno
+//                    a los escritores.
+// RW_PTHREAD_WRITER  pthread_rwlock_t con PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP:
+//                    un escritor en espera bloquea a los lectores nuevos.
+// RW_BIASED          sesgado a lectores: cada hilo marca su lectura en un
+//                    contador propio (en su propia línea de caché), así los
+//                    lectores no comparten ninguna línea que se escriba. El
+//                    escritor levanta una bandera y espera a que todos los
+//                    contadores vuelvan a cero.
+// RW_PHASE_FAIR      phase-fair con tickets (Brandenburg y Anderson): lectores
+//                    y escritores se alternan por fases, ninguno espera más de
+//                    una fase del otro.
+
+#define RW_READER_SLOTS 64      // Contadores de lectores del lock sesgado
+
+enum rw_policy {
+    RW_PTHREAD,
+    RW_PTHREAD_WRITER,
+    RW_BIASED,
+    RW_PHASE_FAIR,
+};
+
+// Contador de lectores de un hilo, en su propia línea de caché
+struct rw_reader_slot {
+    atomic_uint readers;
+} __attribute__((aligned(64)));
+
+struct rw_lock {
+    enum rw_policy policy;
+    union {
+        pthread_rwlock_t rwlock;            // RW_PTHREAD, RW_PTHREAD_WRITER
+        struct {                            // RW_BIASED
+            atomic_int writer;              // 1 mientras un escritor tiene o espera el lock
+            pthread_mutex_t writers;        // Serializa a los escritores
+            struct rw_reader_slot* slots;
+        } biased;
+        struct {                            // RW_PHASE_FAIR
+            atomic_uint rin, rout;          // Tickets de lectores (y bits del escritor en rin)
+            atomic_uint win, wout;          // Tickets de escritores
+        } pf;
+    };
+};
+
+// Nombre corto de una política
+const char* rw_policy_name(enum rw_policy policy);
+
+// Inicializar / destruir el lock (0 si se pudo inicializar)
+int rw_init(struct rw_lock* lock, enum rw_policy policy);
+void rw_destroy(struct rw_lock* lock);
+
+// Tomar y soltar el lock en modo lectura o escritura. rw_rdlock y
+// rw_wrlock devuelven distinto de 0 si hubo que esperar.
+int rw_rdlock(struct rw_lock* lock);
+void rw_rdunlock(struct rw_lock* lock);
+int rw_wrlock(struct rw_lock* lock);
+void rw_wrunlock(struct rw_lock* lock);
+
+#endif
@@ -0,0 +1,79 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+
+#include "histogram.h"
+#include "list.h"
+#include "scan.h"
+#include "simd.h"
+#include "workload.h"
+
+// Tiempo medio por búsqueda, en nanosegundos, de `lookups` llamadas a Member
+static double TimeLookups(const struct list_impl* impl, const int* keys, int lookups, long* found) {
+    long hits = 0;
+    uint64_t start = now_ns();
+    for (int i = 0; i < lookups; i++) {
+        hits += impl->Member(keys[i]);
+    }
+    uint64_t end = now_ns();
+    *found = hits;
+    return (double)(end - start) / lookups;
+}
+
+// Cargar `elements` claves pares (así la mitad de las búsquedas falla)
+static void Populate(const struct list_impl* impl, int elements) {
+    impl->init();
+    if (impl->thread_init != NULL)
+        impl->thread_init();
+    for (int i = 0; i < elements; i++) {
+        impl->Insert(2 * i);
+    }
+}
+
+static void Release(const struct list_impl* impl) {
+    if (impl->thread_exit != NULL)
+        impl->thread_exit();
+    impl->destroy();
+}
+
+void run_scan_benchmark(int elements, int lookups, uint64_t seed) {
+    const struct list_impl* linked = list_find_impl("global");
+    const struct list_impl* unrolled = list_find_impl("unrolled");
+    const char* previous = simd_selected();
+
+    // Las mismas claves de búsqueda para todas las variantes
+    int* keys = malloc((size_t)lookups * sizeof(int));
+    if (keys == NULL) {
+        fprintf(stderr, "Error de asignación de memoria\n");
+        exit(EXIT_FAILURE);
+    }
+    uint64_t rng = seed != 0 ? seed : 1;
+    for (int i = 0; i < lookups; i++) {
+        keys[i] = (int)((workload_rand(&rng) >> 32) % (uint64_t)(2 * elements));
+    }
+
+    printf("Búsqueda en un hilo: %d elementos, %d búsquedas\n", elements, lookups);
+    printf("  %-26s %12s %10s %10s\n", "Variante", "ns/búsqueda", "aciertos", "speedup");
+
+    Populate(linked, elements);
+    long found;
+    double base = TimeLookups(linked, keys, lookups, &found);
+    printf("  %-26s %12.1f %10ld %9.2fx\n", "global (un nodo por clave)", base, found, 1.0);
+    Release(linked);
+
+    static const char* const versions[] = { "scalar", "sse2", "avx2" };
+    Populate(unrolled, elements);
+    for (int v = 0; v < 3; v++) {
+        char label[32];
+        snprintf(label, sizeof(label), "unrolled (%s)", versions[v]);
+        if (simd_select(versions[v]) != 0) {
+            printf("  %-26s %12s\n", label, "no soportada");
+            continue;
+        }
+        double t = TimeLookups(unrolled, keys, lookups, &found);
+        printf("  %-26s %12.1f %10ld %9.2fx\n", label, t, found, base / t);
+    }
+    Release(unrolled);
+
+    simd_select(previous);
+    free(keys);
+}
@@ -0,0 +1,11 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stdint.h>     // Para uint64_t
+
+// Comparar, en un solo hilo y sobre los mismos datos, el Member de la lista
+// de linked/one_entire con el de la lista desenrollada usando cada versión
+// de la búsqueda dentro del nodo (escalar, SSE2, AVX2).
+void run_scan_benchmark(int elements, int lookups, uint64_t seed);
+
+#endif
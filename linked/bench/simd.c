@@ -0,0 +1,108 @@
+#include <string.h>     // Para strcmp
+
+#include "simd.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>  // Para intrínsecos SSE2 y AVX2
+#define SIMD_X86 1
+#endif
+
+// Versión escalar: el mismo recorrido que Member en linked/one_entire/le1.c
+int keys_lower_bound_scalar(const int* keys, int count, int value) {
+    int i = 0;
+    while (i < count && keys[i] < value)
+        i++;
+    return i;
+}
+
+#ifdef SIMD_X86
+
+// Como las claves están ordenadas, la posición buscada es la cantidad de
+// claves menores que value: se comparan varias a la vez y se cuentan los bits.
+
+__attribute__((target("sse2")))
+static int LowerBoundSse2(const int* keys, int count, int value) {
+    __m128i v = _mm_set1_epi32(value);
+    int less = 0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i k = _mm_loadu_si128((const __m128i*)&keys[i]);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(k, v)));
+        less += __builtin_popcount(mask);
+    }
+    // Las últimas claves (menos de 4) sin leer fuera del arreglo
+    for (; i < count; i++)
+        less += keys[i] < value;
+    return less;
+}
+
+__attribute__((target("avx2")))
+static int LowerBoundAvx2(const int* keys, int count, int value) {
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i v = _mm256_set1_epi32(value);
+    int less = 0;
+    for (int i = 0; i < count; i += 8) {
+        // Carga enmascarada: los carriles fuera del arreglo no se leen
+        __m256i valid = _mm256_cmpgt_epi32(_mm256_set1_epi32(count - i), lanes);
+        __m256i k = _mm256_maskload_epi32(&keys[i], valid);
+        __m256i lt = _mm256_and_si256(_mm256_cmpgt_epi32(v, k), valid);
+        less += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(lt)));
+    }
+    return less;
+}
+
+const keys_lower_bound_fn keys_lower_bound_sse2 = LowerBoundSse2;
+const keys_lower_bound_fn keys_lower_bound_avx2 = LowerBoundAvx2;
+
+#else
+
+const keys_lower_bound_fn keys_lower_bound_sse2 = NULL;
+const keys_lower_bound_fn keys_lower_bound_avx2 = NULL;
+
+#endif
+
+keys_lower_bound_fn keys_lower_bound = keys_lower_bound_scalar;
+static const char* selected = "scalar";
+
+// Buscar la versión por nombre (NULL si no se puede usar)
+keys_lower_bound_fn simd_find(const char* name) {
+    if (strcmp(name, "scalar") == 0)
+        return keys_lower_bound_scalar;
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (strcmp(name, "sse2") == 0 && __builtin_cpu_supports("sse2"))
+        return keys_lower_bound_sse2;
+    if (strcmp(name, "avx2") == 0 && __builtin_cpu_supports("avx2"))
+        return keys_lower_bound_avx2;
+#endif
+    return NULL;
+}
+
+// Elegir la versión de la búsqueda dentro de los nodos
+int simd_select(const char* name) {
+    if (strcmp(name, "auto") == 0) {
+        static const char* const preferred[] = { "avx2", "sse2", "scalar" };
+        for (int i = 0; i < 3; i++) {
+            if (simd_find(preferred[i]) != NULL)
+                return simd_select(preferred[i]);
+        }
+    }
+
+    static const char* const names[] = { "scalar", "sse2", "avx2" };
+    for (int i = 0; i < 3; i++) {
+        if (strcmp(name, names[i]) != 0)
+            continue;
+        keys_lower_bound_fn fn = simd_find(name);
+        if (fn == NULL)
+            return -1; // El procesador no la soporta
+        keys_lower_bound = fn;
+        selected = names[i];
+        return 0;
+    }
+    return -1;
+}
+
+// Nombre de la versión en uso
+const char* simd_selected(void) {
+    return selected;
+}
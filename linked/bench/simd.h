@@ -0,0 +1,29 @@
+#ifndef SIMD_H
+#define SIMD_H
+
+// Búsqueda de la posición de una clave dentro del arreglo ordenado de un
+// nodo. Hay una versión escalar y, en x86, versiones SSE2 y AVX2 que
+// comparan 4 u 8 claves por instrucción. La versión se elige en tiempo de
+// ejecución según lo que soporte el procesador.
+
+typedef int (*keys_lower_bound_fn)(const int* keys, int count, int value);
+
+// Versión en uso: posición de la primera clave >= value (count si no hay)
+extern keys_lower_bound_fn keys_lower_bound;
+
+// Versiones disponibles (NULL si no existe en esta arquitectura)
+int keys_lower_bound_scalar(const int* keys, int count, int value);
+extern const keys_lower_bound_fn keys_lower_bound_sse2;
+extern const keys_lower_bound_fn keys_lower_bound_avx2;
+
+// Elegir la versión: "auto", "scalar", "sse2" o "avx2". Devuelve 0 si se
+// pudo, -1 si no existe o el procesador no la soporta.
+int simd_select(const char* name);
+
+// Nombre de la versión en uso
+const char* simd_selected(void);
+
+// Buscar la versión por nombre (NULL si no se puede usar)
+keys_lower_bound_fn simd_find(const char* name);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SPIN_H
+#define SPIN_H
+
+#include <sched.h>      // Para sched_yield
+
+// Vueltas de espera activa antes de ceder el procesador
+#define SPINS_BEFORE_YIELD 64
+
+// Esperar un poco dentro de un bucle de espera activa. Con más hilos que
+// CPUs el hilo que se espera puede no estar corriendo, así que después de
+// unas vueltas se cede el procesador.
+static inline void spin_relax(unsigned* spins) {
+    if (++*spins < SPINS_BEFORE_YIELD) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    } else {
+        *spins = 0;
+        sched_yield();
+    }
+}
+
+#endif
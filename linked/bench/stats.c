@@ -0,0 +1,128 @@
+#include "stats.h"
+
+#ifdef LIST_STATS
+
+#include <string.h>     // Para memset
+#include <pthread.h>    // Para el mutex de los totales
+
+// Locks que un hilo puede tener a la vez: mano a mano usa dos y la skip
+// list uno por nivel más el del nodo que borra
+#define STATS_MAX_HELD 32
+
+struct lock_stats {
+    uint64_t attempts;              // Veces que se tomó un lock
+    uint64_t contended;             // Veces que estaba ocupado
+    struct histogram wait;          // Espera hasta tomarlo (ns)
+    struct histogram hold;          // Tiempo con el lock tomado (ns)
+    struct histogram visited;       // Nodos recorridos por operación
+};
+
+__thread uint64_t stats_visited = 0;
+
+static __thread struct lock_stats local;
+static __thread struct {
+    const void* lock;
+    uint64_t since;
+} held[STATS_MAX_HELD];
+
+static pthread_mutex_t totals_mutex = PTHREAD_MUTEX_INITIALIZER;
+static struct lock_stats totals;
+
+void stats_lock_acquired(const void* lock, uint64_t wait_start, int contended) {
+    uint64_t now = now_ns();
+    local.attempts++;
+    local.contended += (contended != 0);
+    hist_record(&local.wait, now - wait_start);
+
+    for (int i = 0; i < STATS_MAX_HELD; i++) {
+        if (held[i].lock == NULL) {
+            held[i].lock = lock;
+            held[i].since = now;
+            return;
+        }
+    }
+}
+
+void stats_lock_released(const void* lock) {
+    for (int i = 0; i < STATS_MAX_HELD; i++) {
+        if (held[i].lock == lock) {
+            hist_record(&local.hold, now_ns() - held[i].since);
+            held[i].lock = NULL;
+            return;
+        }
+    }
+}
+
+void stats_op_done(int n) {
+    uint64_t per_op = stats_visited / n;
+    for (int i = 0; i < n; i++) {
+        hist_record(&local.visited, per_op);
+    }
+    stats_visited = 0;
+}
+
+void stats_reset(void) {
+    pthread_mutex_lock(&totals_mutex);
+    memset(&totals, 0, sizeof(totals));
+    pthread_mutex_unlock(&totals_mutex);
+}
+
+void stats_thread_flush(void) {
+    pthread_mutex_lock(&totals_mutex);
+    totals.attempts += local.attempts;
+    totals.contended += local.contended;
+    hist_merge(&totals.wait, &local.wait);
+    hist_merge(&totals.hold, &local.hold);
+    hist_merge(&totals.visited, &local.visited);
+    pthread_mutex_unlock(&totals_mutex);
+
+    memset(&local, 0, sizeof(local));
+    memset(held, 0, sizeof(held));
+    stats_visited = 0;
+}
+
+// Ancho de `name` en la columna: printf cuenta bytes, no caracteres
+static int LabelWidth(const char* name, int width) {
+    for (const char* c = name; *c != '\0'; c++) {
+        if ((*c & 0xC0) == 0x80)
+            width++;
+    }
+    return width;
+}
+
+void stats_thread_reset(void) {
+    memset(&local, 0, sizeof(local));
+    stats_visited = 0;
+    // Los locks tomados en este momento se siguen midiendo al soltarlos
+}
+
+static void PrintHistogram(FILE* out, const char* name, const struct histogram* h) {
+    if (h->count == 0)
+        return;
+    fprintf(out, "    %-*s %10llu %8llu %8llu %8llu %10.1f %10llu\n", LabelWidth(name, 16), name,
+            (unsigned long long)h->count,
+            (unsigned long long)hist_percentile(h, 50.0),
+            (unsigned long long)hist_percentile(h, 90.0),
+            (unsigned long long)hist_percentile(h, 99.0),
+            (double)h->sum / h->count,
+            (unsigned long long)h->max);
+}
+
+void stats_report(FILE* out) {
+    pthread_mutex_lock(&totals_mutex);
+    if (totals.attempts == 0) {
+        fprintf(out, "    Locks: ninguno en esta fase\n");
+    } else {
+        fprintf(out, "    Locks: %llu tomados, %llu con espera (%.2f %%)\n",
+                (unsigned long long)totals.attempts, (unsigned long long)totals.contended,
+                100.0 * totals.contended / totals.attempts);
+    }
+    fprintf(out, "    %-*s %10s %8s %8s %8s %10s %10s\n", LabelWidth("Contención", 16),
+            "Contención", "muestras", "p50", "p90", "p99", "media", "max");
+    PrintHistogram(out, "espera (ns)", &totals.wait);
+    PrintHistogram(out, "retención (ns)", &totals.hold);
+    PrintHistogram(out, "nodos por op", &totals.visited);
+    pthread_mutex_unlock(&totals_mutex);
+}
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>      // Para FILE
+#include <stdint.h>     // Para uint64_t
+#include <pthread.h>    // Para los mutex de STATS_MUTEX_LOCK
+
+// Instrumentación de contención en el camino caliente. Sólo existe si se
+// compila con -DLIST_STATS; si no, las macros no generan código:
+//
+//   gcc -O2 -DLIST_STATS -pthread -o bench *.c -lm
+//
+// Cada hilo cuenta en variables propias los intentos de tomar un lock, los
+// que tuvieron que esperar, el tiempo de espera y de retención de cada lock
+// y los nodos recorridos por operación. Al terminar el hilo se suman a los
+// totales de la fase.
+
+#ifdef LIST_STATS
+
+#include "histogram.h"
+
+extern __thread uint64_t stats_visited;   // Nodos recorridos en la operación actual
+
+// Registrar que se tomó `lock`: la espera empezó en `wait_start` y
+// `contended` es distinto de 0 si el lock estaba ocupado
+void stats_lock_acquired(const void* lock, uint64_t wait_start, int contended);
+
+// Registrar que se va a soltar `lock` (mide el tiempo de retención)
+void stats_lock_released(const void* lock);
+
+// Contar un nodo recorrido
+#define STATS_VISIT() (stats_visited++)
+
+// Tomar / soltar un lock con medición. `acquire` debe valer distinto de 0
+// si tuvo que esperar.
+#define STATS_LOCK(l, acquire) do {                 \
+        uint64_t stats_start_ = now_ns();           \
+        int stats_contended_ = (acquire);           \
+        stats_lock_acquired((l), stats_start_, stats_contended_); \
+    } while (0)
+#define STATS_UNLOCK(l, release) do {               \
+        stats_lock_released(l);                     \
+        release;                                    \
+    } while (0)
+
+// Para locks que no se toman con una sola llamada (el del combinador en fc):
+// marcar el comienzo de la espera y registrar después la toma
+#define STATS_WAIT_START() now_ns()
+#define STATS_LOCKED(l, wait_start, contended) \
+    stats_lock_acquired((l), (wait_start), (contended))
+
+// Cerrar las `n` operaciones recién hechas (n > 1 en un lote): cada una
+// registra su parte de los nodos recorridos
+void stats_op_done(int n);
+
+// Vaciar los totales antes de una fase
+void stats_reset(void);
+
+// Sumar los contadores del hilo actual a los totales y vaciarlos
+void stats_thread_flush(void);
+
+// Descartar lo contado por el hilo actual (fin del calentamiento)
+void stats_thread_reset(void);
+
+// Imprimir los totales de la fase
+void stats_report(FILE* out);
+
+#else
+
+#define STATS_VISIT() ((void)0)
+#define STATS_LOCK(l, acquire) ((void)(acquire))
+#define STATS_UNLOCK(l, release) release
+#define STATS_WAIT_START() ((uint64_t)0)
+#define STATS_LOCKED(l, wait_start, contended) ((void)(wait_start), (void)(contended))
+
+static inline void stats_op_done(int n) { (void)n; }
+static inline void stats_reset(void) {}
+static inline void stats_thread_flush(void) {}
+static inline void stats_thread_reset(void) {}
+static inline void stats_report(FILE* out) { (void)out; }
+
+#endif
+
+// Valor de `acquire` para un lock bloqueante: con LIST_STATS se prueba antes
+// con `try_call` para saber si hubo que esperar; sin ella sólo queda `call`,
+// sin la operación atómica de más
+#ifdef LIST_STATS
+#define STATS_PROBE(try_call, call) ((try_call) != 0 ? ((call), 1) : 0)
+#else
+#define STATS_PROBE(try_call, call) ((call), 0)
+#endif
+
+// Tomar / soltar un mutex de pthread con medición
+#define STATS_MUTEX_LOCK(m) \
+    STATS_LOCK((m), STATS_PROBE(pthread_mutex_trylock(m), pthread_mutex_lock(m)))
+#define STATS_MUTEX_UNLOCK(m) STATS_UNLOCK((m), pthread_mutex_unlock(m))
+
+#endif
@@ -0,0 +1,226 @@
+#define _GNU_SOURCE     // Para pthread_setaffinity_np y CPU_SET
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para strcmp
+#include <pthread.h>    // Para pthread_setaffinity_np
+#include <sched.h>      // Para cpu_set_t
+#include <unistd.h>     // Para syscall
+#include <sys/syscall.h>        // Para SYS_set_mempolicy
+#include <linux/mempolicy.h>    // Para MPOL_PREFERRED
+
+#include "topology.h"
+
+#define MAX_CPUS 1024
+
+struct cpu_info {
+    int cpu;
+    int node;       // Nodo NUMA (0 si el sistema no tiene NUMA)
+    int package;    // Socket
+    int core;       // Núcleo dentro del socket
+    int smt;        // 0 para el primer hilo de hardware del núcleo, 1 el segundo...
+};
+
+enum pin_policy { PIN_NONE, PIN_COMPACT, PIN_SCATTER };
+
+static struct cpu_info cpus[MAX_CPUS];
+static int num_cpus = 0;
+static int num_nodes = 1;
+static int num_packages = 1;
+
+static enum pin_policy policy = PIN_NONE;
+static int selected_node = -1;
+static int order[MAX_CPUS];     // CPUs en el orden en que se asignan a los hilos
+static int num_order = 0;
+
+// Leer un entero de un archivo de /sys (-1 si no existe)
+static int ReadInt(const char* path) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL)
+        return -1;
+    int value;
+    if (fscanf(f, "%d", &value) != 1)
+        value = -1;
+    fclose(f);
+    return value;
+}
+
+// Leer una lista de CPUs como "0-3,8-11" y marcar cada una en `set`
+static int ReadCpuList(const char* path, char set[MAX_CPUS]) {
+    FILE* f = fopen(path, "r");
+    if (f == NULL)
+        return -1;
+    int first, last;
+    while (fscanf(f, "%d", &first) == 1) {
+        last = first;
+        int c = fgetc(f);
+        if (c == '-') {
+            if (fscanf(f, "%d", &last) != 1)
+                break;
+            c = fgetc(f);
+        }
+        for (int cpu = first; cpu <= last && cpu < MAX_CPUS; cpu++) {
+            set[cpu] = 1;
+        }
+        if (c != ',')
+            break;
+    }
+    fclose(f);
+    return 0;
+}
+
+// Cargar la topología desde /sys
+static void LoadTopology(void) {
+    char online[MAX_CPUS] = {0};
+    char path[256];
+
+    if (ReadCpuList("/sys/devices/system/cpu/online", online) != 0) {
+        // Sin /sys: una CPU por cada procesador en línea, sin estructura
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        for (long i = 0; i < n && i < MAX_CPUS; i++) {
+            online[i] = 1;
+        }
+    }
+
+    for (int cpu = 0; cpu < MAX_CPUS; cpu++) {
+        if (!online[cpu])
+            continue;
+        struct cpu_info* info = &cpus[num_cpus++];
+        info->cpu = cpu;
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", cpu);
+        info->package = ReadInt(path);
+        if (info->package < 0)
+            info->package = 0;
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/topology/core_id", cpu);
+        info->core = ReadInt(path);
+        if (info->core < 0)
+            info->core = cpu;
+        info->node = 0;
+        info->smt = 0;
+    }
+
+    // Nodo NUMA de cada CPU
+    for (int node = 0; node < MAX_CPUS; node++) {
+        char set[MAX_CPUS] = {0};
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+        if (ReadCpuList(path, set) != 0)
+            continue;
+        for (int i = 0; i < num_cpus; i++) {
+            if (set[cpus[i].cpu])
+                cpus[i].node = node;
+        }
+        if (node + 1 > num_nodes)
+            num_nodes = node + 1;
+    }
+
+    // Número de hilo de hardware dentro de cada núcleo
+    for (int i = 0; i < num_cpus; i++) {
+        if (cpus[i].package + 1 > num_packages)
+            num_packages = cpus[i].package + 1;
+        for (int j = 0; j < i; j++) {
+            if (cpus[j].package == cpus[i].package && cpus[j].core == cpus[i].core)
+                cpus[i].smt++;
+        }
+    }
+}
+
+// compact: los hilos de hardware de un núcleo van juntos, después el
+// siguiente núcleo del mismo socket y nodo
+static int CompareCompact(const void* a, const void* b) {
+    const struct cpu_info* x = &cpus[*(const int*)a];
+    const struct cpu_info* y = &cpus[*(const int*)b];
+    if (x->node != y->node) return x->node - y->node;
+    if (x->package != y->package) return x->package - y->package;
+    if (x->core != y->core) return x->core - y->core;
+    return x->cpu - y->cpu;
+}
+
+// Dominio que scatter alterna: el nodo NUMA, o el socket si hay un solo nodo
+static int Domain(const struct cpu_info* info) {
+    return num_nodes > 1 ? info->node : info->package;
+}
+
+// scatter: primero un hilo de hardware por núcleo, alternando dominios
+static int CompareScatter(const void* a, const void* b) {
+    const struct cpu_info* x = &cpus[*(const int*)a];
+    const struct cpu_info* y = &cpus[*(const int*)b];
+    if (x->smt != y->smt) return x->smt - y->smt;
+    if (x->core != y->core) return x->core - y->core;
+    if (Domain(x) != Domain(y)) return Domain(x) - Domain(y);
+    return x->cpu - y->cpu;
+}
+
+int placement_setup(const char* pin, int numa_node) {
+    if (strcmp(pin, "none") == 0)
+        policy = PIN_NONE;
+    else if (strcmp(pin, "compact") == 0)
+        policy = PIN_COMPACT;
+    else if (strcmp(pin, "scatter") == 0)
+        policy = PIN_SCATTER;
+    else
+        return -1;
+
+    if (num_cpus == 0)
+        LoadTopology();
+
+    selected_node = numa_node;
+    num_order = 0;
+    for (int i = 0; i < num_cpus; i++) {
+        if (numa_node < 0 || cpus[i].node == numa_node)
+            order[num_order++] = i;
+    }
+    if (num_order == 0)
+        return -1; // El nodo no existe o no tiene CPUs
+
+    // Con un nodo elegido y sin política, igual se restringe a sus CPUs
+    if (policy == PIN_NONE && numa_node >= 0)
+        policy = PIN_COMPACT;
+
+    if (policy == PIN_COMPACT)
+        qsort(order, num_order, sizeof(int), CompareCompact);
+    else if (policy == PIN_SCATTER)
+        qsort(order, num_order, sizeof(int), CompareScatter);
+    return 0;
+}
+
+int placement_cpu(int thread_id) {
+    if (policy == PIN_NONE || num_order == 0)
+        return -1;
+    return cpus[order[thread_id % num_order]].cpu;
+}
+
+void placement_apply(int thread_id) {
+    int cpu = placement_cpu(thread_id);
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+            fprintf(stderr, "No se pudo fijar el hilo %d a la CPU %d\n", thread_id, cpu);
+    }
+
+    // La memoria que reserve este hilo (slabs del pool) va al nodo elegido
+    if (selected_node >= 0) {
+        unsigned long mask[MAX_CPUS / (8 * sizeof(unsigned long))] = {0};
+        mask[selected_node / (8 * sizeof(unsigned long))] |= 1UL << (selected_node % (8 * sizeof(unsigned long)));
+        if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask, (unsigned long)MAX_CPUS) != 0)
+            fprintf(stderr, "No se pudo preferir el nodo NUMA %d para la memoria\n", selected_node);
+    }
+}
+
+void placement_report(FILE* out, int ths) {
+    static const char* const names[] = { "none", "compact", "scatter" };
+    fprintf(out, "Topología: %d CPUs, %d sockets, %d nodos NUMA; ubicación: %s",
+           num_cpus, num_packages, num_nodes, names[policy]);
+    if (selected_node >= 0)
+        fprintf(out, ", nodo %d", selected_node);
+    fprintf(out, "\n");
+
+    if (policy == PIN_NONE)
+        return;
+    fprintf(out, "  Hilo -> CPU (nodo/socket/núcleo):");
+    for (int i = 0; i < ths; i++) {
+        const struct cpu_info* info = &cpus[order[i % num_order]];
+        fprintf(out, " %d->%d(%d/%d/%d)", i, info->cpu, info->node, info->package, info->core);
+    }
+    fprintf(out, "\n");
+}
@@ -0,0 +1,29 @@
+#ifndef TOPOLOGY_H
+#define TOPOLOGY_H
+
+#include <stdio.h>      // Para FILE
+
+// Topología de la máquina (CPUs, núcleos, sockets y nodos NUMA, leída de
+// /sys) y ubicación de los hilos de trabajo en ella.
+//
+//   none     el planificador decide (sin afinidad)
+//   compact  llenar un núcleo, socket y nodo antes de pasar al siguiente
+//   scatter  repartir los hilos entre nodos (o sockets) y después entre núcleos
+//
+// Con un nodo NUMA elegido sólo se usan sus CPUs y la memoria que reservan
+// los hilos (los slabs de pool.c) se pide preferentemente en ese nodo.
+
+// Preparar la ubicación. numa_node < 0 usa todos los nodos. Devuelve 0 si
+// todo es válido, -1 si la política o el nodo no existen.
+int placement_setup(const char* pin, int numa_node);
+
+// Fijar el hilo actual según su número (se llama al empezar cada hilo)
+void placement_apply(int thread_id);
+
+// CPU asignada al hilo `thread_id`, o -1 si no se fija
+int placement_cpu(int thread_id);
+
+// Imprimir la topología y la CPU de cada uno de los `ths` hilos
+void placement_report(FILE* out, int ths);
+
+#endif
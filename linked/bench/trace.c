@@ -0,0 +1,290 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para memcmp, memset y strtok_r
+#include <strings.h>    // Para strcasecmp
+#include <ctype.h>      // Para isdigit
+#include <fcntl.h>      // Para open
+#include <unistd.h>     // Para close
+#include <sys/mman.h>   // Para mmap y madvise
+#include <sys/stat.h>   // Para fstat
+
+#include "trace.h"
+#include "workload.h"
+
+#define TRACE_MAX_THREADS 65536
+
+// Registro leído del CSV, antes de agruparlo por hilo
+struct csv_record {
+    uint64_t time_ns;
+    int thread;
+    int key;
+    int op;
+    long line;                  // Para desempatar: orden del archivo
+};
+
+static size_t RoundUp64(size_t n) {
+    return (n + 63) & ~(size_t)63;
+}
+
+static int ParseOp(const char* text) {
+    if (strcasecmp(text, "member") == 0 || strcasecmp(text, "m") == 0)
+        return OP_MEMBER;
+    if (strcasecmp(text, "insert") == 0 || strcasecmp(text, "i") == 0)
+        return OP_INSERT;
+    if (strcasecmp(text, "delete") == 0 || strcasecmp(text, "d") == 0)
+        return OP_DELETE;
+    return -1;
+}
+
+// Leer una línea "tiempo,hilo,op,clave". 0 si es válida.
+static int ParseLine(char* line, struct csv_record* rec) {
+    char* fields[4];
+    char* save = NULL;
+    int n = 0;
+    for (char* f = strtok_r(line, ",\r\n", &save); f != NULL; f = strtok_r(NULL, ",\r\n", &save)) {
+        if (n == 4)
+            return -1;
+        while (*f == ' ' || *f == '\t')
+            f++;
+        char* end = f + strlen(f);
+        while (end > f && (end[-1] == ' ' || end[-1] == '\t'))
+            *--end = '\0';
+        fields[n++] = f;
+    }
+    if (n != 4)
+        return -1;
+
+    char* end;
+    unsigned long long time_ns = strtoull(fields[0], &end, 10);
+    if (*fields[0] == '\0' || *end != '\0')
+        return -1;
+    long thread = strtol(fields[1], &end, 10);
+    if (*fields[1] == '\0' || *end != '\0' || thread < 0 || thread >= TRACE_MAX_THREADS)
+        return -1;
+    long key = strtol(fields[3], &end, 10);
+    if (*fields[3] == '\0' || *end != '\0' || key < 0 || key > 2147483647L)
+        return -1;
+    int op = ParseOp(fields[2]);
+    if (op < 0)
+        return -1;
+
+    rec->time_ns = time_ns;
+    rec->thread = (int)thread;
+    rec->key = (int)key;
+    rec->op = op;
+    return 0;
+}
+
+// Ordenar por hilo y, dentro de cada hilo, por tiempo y orden del archivo
+static int CompareRecords(const void* a, const void* b) {
+    const struct csv_record* x = (const struct csv_record*)a;
+    const struct csv_record* y = (const struct csv_record*)b;
+    if (x->thread != y->thread)
+        return x->thread - y->thread;
+    if (x->time_ns != y->time_ns)
+        return x->time_ns < y->time_ns ? -1 : 1;
+    return (x->line > y->line) - (x->line < y->line);
+}
+
+// Escribir la traza ya ordenada
+static int WriteTrace(const char* path, const struct csv_record* recs, size_t count,
+                      int threads, int max_key, uint64_t first_time) {
+    FILE* out = fopen(path, "wb");
+    if (out == NULL)
+        return -1;
+
+    struct trace_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.threads = (uint32_t)threads;
+    header.records = count;
+    header.max_key = max_key;
+    int rc = fwrite(&header, sizeof(header), 1, out) == 1 ? 0 : -1;
+
+    size_t i = 0;
+    for (int t = 0; rc == 0 && t < threads; t++) {
+        struct trace_run run = { .first = i, .count = 0 };
+        while (i < count && recs[i].thread == t) {
+            run.count++;
+            i++;
+        }
+        rc = fwrite(&run, sizeof(run), 1, out) == 1 ? 0 : -1;
+    }
+
+    static const char zeros[64];
+    size_t offset = sizeof(header) + (size_t)threads * sizeof(struct trace_run);
+    size_t padding = RoundUp64(offset) - offset;
+    if (rc == 0 && padding > 0 && fwrite(zeros, 1, padding, out) != padding)
+        rc = -1;
+
+    for (i = 0; rc == 0 && i < count; i++) {
+        struct trace_record rec = {
+            .time_ns = recs[i].time_ns - first_time,
+            .key = recs[i].key,
+            .op = (uint32_t)recs[i].op,
+        };
+        rc = fwrite(&rec, sizeof(rec), 1, out) == 1 ? 0 : -1;
+    }
+
+    if (fclose(out) != 0)
+        rc = -1;
+    return rc;
+}
+
+int trace_convert_csv(const char* csv_path, const char* trace_path) {
+    FILE* in = fopen(csv_path, "r");
+    if (in == NULL) {
+        fprintf(stderr, "No se pudo abrir %s\n", csv_path);
+        return -1;
+    }
+
+    struct csv_record* recs = NULL;
+    size_t count = 0, capacity = 0;
+    int threads = 0, max_key = 0;
+    uint64_t first_time = UINT64_MAX;
+    char line[512];
+    long line_no = 0;
+    int rc = 0;
+
+    while (fgets(line, sizeof(line), in) != NULL) {
+        line_no++;
+        if (line[0] == '\n' || line[0] == '\r' || line[0] == '\0')
+            continue;
+        // La primera línea puede ser un encabezado
+        if (line_no == 1 && !isdigit((unsigned char)line[0]))
+            continue;
+
+        if (count == capacity) {
+            capacity = capacity ? 2 * capacity : 4096;
+            struct csv_record* grown = realloc(recs, capacity * sizeof(*recs));
+            if (grown == NULL) {
+                fprintf(stderr, "Error de asignación de memoria\n");
+                rc = -1;
+                break;
+            }
+            recs = grown;
+        }
+        struct csv_record* rec = &recs[count];
+        if (ParseLine(line, rec) != 0) {
+            fprintf(stderr, "%s:%ld: se espera tiempo_ns,hilo,operación,clave\n", csv_path, line_no);
+            rc = -1;
+            break;
+        }
+        rec->line = line_no;
+        if (rec->thread + 1 > threads)
+            threads = rec->thread + 1;
+        if (rec->key > max_key)
+            max_key = rec->key;
+        if (rec->time_ns < first_time)
+            first_time = rec->time_ns;
+        count++;
+    }
+    fclose(in);
+
+    if (rc == 0 && count == 0) {
+        fprintf(stderr, "%s: no hay operaciones\n", csv_path);
+        rc = -1;
+    }
+    if (rc == 0) {
+        qsort(recs, count, sizeof(*recs), CompareRecords);
+        if (WriteTrace(trace_path, recs, count, threads, max_key, first_time) != 0) {
+            fprintf(stderr, "No se pudo escribir %s\n", trace_path);
+            rc = -1;
+        }
+    }
+    free(recs);
+    return rc;
+}
+
+int trace_open(const char* path, struct trace_file* trace) {
+    memset(trace, 0, sizeof(*trace));
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(struct trace_header)) {
+        close(fd);
+        return -1;
+    }
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+    // Se lee una sola vez de principio a fin: el kernel puede leer por
+    // adelantado y descartar lo ya leído
+    madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+
+    trace->map = map;
+    trace->size = (size_t)st.st_size;
+    trace->header = map;
+    const struct trace_header* header = trace->header;
+    if (memcmp(header->magic, TRACE_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != TRACE_VERSION || header->threads == 0 ||
+        header->threads > TRACE_MAX_THREADS)
+        goto invalid;
+
+    size_t offset = sizeof(*header) + (size_t)header->threads * sizeof(struct trace_run);
+    offset = RoundUp64(offset);
+    if (offset > trace->size ||
+        header->records > (trace->size - offset) / sizeof(struct trace_record))
+        goto invalid;
+    trace->runs = (const struct trace_run*)(header + 1);
+    trace->records = (const struct trace_record*)((const char*)map + offset);
+    for (uint32_t t = 0; t < header->threads; t++) {
+        const struct trace_run* run = &trace->runs[t];
+        if (run->first > header->records || run->count > header->records - run->first)
+            goto invalid;
+    }
+    return 0;
+
+invalid:
+    trace_close(trace);
+    return -1;
+}
+
+void trace_close(struct trace_file* trace) {
+    if (trace->map != NULL)
+        munmap(trace->map, trace->size);
+    memset(trace, 0, sizeof(*trace));
+}
+
+int trace_reader_init(struct trace_reader* reader, const struct trace_file* trace, int id, int ths) {
+    int threads = (int)trace->header->threads;
+    reader->count = 0;
+    reader->cursors = malloc((size_t)((threads + ths - 1) / ths + 1) * sizeof(struct trace_cursor));
+    if (reader->cursors == NULL)
+        return -1;
+    for (int t = id; t < threads; t += ths) {
+        const struct trace_run* run = &trace->runs[t];
+        if (run->count == 0)
+            continue;
+        struct trace_cursor* c = &reader->cursors[reader->count++];
+        c->next = trace->records + run->first;
+        c->end = c->next + run->count;
+    }
+    return 0;
+}
+
+void trace_reader_free(struct trace_reader* reader) {
+    free(reader->cursors);
+    reader->cursors = NULL;
+    reader->count = 0;
+}
+
+const struct trace_record* trace_reader_next(struct trace_reader* reader) {
+    for (;;) {
+        // El hilo registrado con el registro más antiguo
+        struct trace_cursor* best = NULL;
+        for (int i = 0; i < reader->count; i++) {
+            struct trace_cursor* c = &reader->cursors[i];
+            if (c->next < c->end && (best == NULL || c->next->time_ns < best->next->time_ns))
+                best = c;
+        }
+        if (best == NULL)
+            return NULL;
+        const struct trace_record* rec = best->next++;
+        if (rec->op < OP_COUNT)
+            return rec; // Los registros con una operación desconocida se saltean
+    }
+}
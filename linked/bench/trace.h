@@ -0,0 +1,88 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>     // Para uint64_t
+#include <stddef.h>     // Para size_t
+
+// Trazas de operaciones registradas (por ejemplo, de un servicio en
+// producción) para repetirlas contra cualquier backend (--trace).
+//
+// Formato binario (orden de bytes de la máquina):
+//
+//   struct trace_header                 magic, versión, hilos, registros, clave máxima
+//   struct trace_run[threads]           dónde empiezan los registros de cada hilo
+//   relleno hasta múltiplo de 64 bytes
+//   struct trace_record[records]        agrupados por hilo, en orden de tiempo
+//
+// Los registros de cada hilo registrado son contiguos, así un hilo de la
+// repetición lee sólo su parte del archivo. El archivo se recorre con mmap
+// de principio a fin sin copiarlo a memoria propia.
+//
+// Formato CSV que acepta el conversor (--csv-to-trace), una línea por operación:
+//
+//   tiempo_ns,hilo,operación,clave
+//
+// La operación es Member, Insert o Delete (o M, I, D). La primera línea
+// puede ser un encabezado. Los tiempos se guardan relativos al menor.
+
+#define TRACE_MAGIC "LSTTRACE"
+#define TRACE_VERSION 1
+
+struct trace_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t threads;           // Hilos registrados (identificadores 0..threads-1)
+    uint64_t records;
+    int32_t max_key;            // Clave más alta (para --key-range)
+    uint32_t reserved;
+};
+
+struct trace_run {
+    uint64_t first;             // Índice del primer registro del hilo
+    uint64_t count;
+};
+
+struct trace_record {
+    uint64_t time_ns;           // Desde el comienzo de la traza
+    int32_t key;
+    uint32_t op;                // enum op_type
+};
+
+// Traza abierta con mmap
+struct trace_file {
+    void* map;
+    size_t size;
+    const struct trace_header* header;
+    const struct trace_run* runs;
+    const struct trace_record* records;
+};
+
+// Posición dentro de los registros de un hilo registrado
+struct trace_cursor {
+    const struct trace_record* next;
+    const struct trace_record* end;
+};
+
+// Lector de un hilo de la repetición: mezcla por tiempo los hilos
+// registrados que le tocan (t, t + ths, t + 2 * ths, ...)
+struct trace_reader {
+    struct trace_cursor* cursors;
+    int count;
+};
+
+// Convertir un CSV en una traza binaria. 0 si se pudo (los errores se
+// informan por stderr con el número de línea).
+int trace_convert_csv(const char* csv_path, const char* trace_path);
+
+// Abrir / cerrar una traza. 0 si es válida.
+int trace_open(const char* path, struct trace_file* trace);
+void trace_close(struct trace_file* trace);
+
+// Preparar el lector del hilo `id` de `ths` hilos de repetición. 0 si se pudo.
+int trace_reader_init(struct trace_reader* reader, const struct trace_file* trace, int id, int ths);
+void trace_reader_free(struct trace_reader* reader);
+
+// Siguiente registro en orden de tiempo, o NULL al terminar
+const struct trace_record* trace_reader_next(struct trace_reader* reader);
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef UNROLLED_H
+#define UNROLLED_H
+
+#include <string.h>     // Para memmove
+
+#include "simd.h"
+
+// Operaciones sobre el arreglo ordenado de claves de un nodo de la lista
+// desenrollada (list_unrolled.c y list_unrolled_hoh.c).
+
+// Posición de la primera clave >= value (count si no hay ninguna), con la
+// versión escalar o vectorial elegida con --simd
+static inline int KeysLowerBound(const int* keys, int count, int value) {
+    return keys_lower_bound(keys, count, value);
+}
+
+// Insertar value en la posición pos
+static inline void KeysInsertAt(int* keys, int* count, int pos, int value) {
+    memmove(&keys[pos + 1], &keys[pos], (*count - pos) * sizeof(int));
+    keys[pos] = value;
+    (*count)++;
+}
+
+// Quitar la clave de la posición pos
+static inline void KeysRemoveAt(int* keys, int* count, int pos) {
+    memmove(&keys[pos], &keys[pos + 1], (*count - pos - 1) * sizeof(int));
+    (*count)--;
+}
+
+#endif
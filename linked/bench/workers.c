@@ -0,0 +1,160 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para strcmp
+#include <limits.h>     // Para INT_MAX
+#include <pthread.h>    // Para funciones de manejo de hilos
+#include <stdatomic.h>  // Para operaciones atómicas
+#include <unistd.h>     // Para syscall
+#include <sys/syscall.h>        // Para SYS_futex
+#include <linux/futex.h>        // Para FUTEX_WAIT_PRIVATE y FUTEX_WAKE_PRIVATE
+
+#include "spin.h"
+#include "workers.h"
+
+// Un hilo del grupo
+struct worker {
+    struct worker_pool* pool;
+    int id;
+    pthread_t thread;
+};
+
+struct worker_pool {
+    int ths;
+    enum workers_handoff handoff;
+    void (*start)(int id);
+    void (*stop)(int id);
+    struct worker* workers;
+
+    // Fase actual: la escribe el hilo principal antes de avanzar generation
+    void* (*fn)(void*);         // NULL = terminar
+    char* args;
+    size_t stride;
+
+    // Cada contador en su propia línea: los hilos esperan sobre generation
+    // y el principal sobre remaining
+    _Alignas(64) atomic_uint generation;       // Fases publicadas
+    _Alignas(64) atomic_uint remaining;        // Hilos que no terminaron la fase
+};
+
+static void FutexWait(atomic_uint* word, unsigned expected) {
+    syscall(SYS_futex, (unsigned*)word, FUTEX_WAIT_PRIVATE, expected, NULL, NULL, 0);
+}
+
+static void FutexWake(atomic_uint* word) {
+    syscall(SYS_futex, (unsigned*)word, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+}
+
+// Esperar a que `word` deje de valer `value`; devuelve el valor nuevo
+static unsigned WaitWhileEqual(const struct worker_pool* pool, atomic_uint* word, unsigned value) {
+    unsigned spins = 0;
+    unsigned now;
+    while ((now = atomic_load_explicit(word, memory_order_acquire)) == value) {
+        if (pool->handoff == HANDOFF_FUTEX)
+            FutexWait(word, value); // Vuelve enseguida si word ya cambió
+        else
+            spin_relax(&spins);
+    }
+    return now;
+}
+
+static void* Worker(void* arg) {
+    struct worker* self = (struct worker*)arg;
+    struct worker_pool* pool = self->pool;
+
+    if (pool->start != NULL)
+        pool->start(self->id);
+
+    unsigned seen = 0;
+    for (;;) {
+        seen = WaitWhileEqual(pool, &pool->generation, seen);
+        if (pool->fn == NULL)
+            break;
+        pool->fn(pool->args + (size_t)self->id * pool->stride);
+        // El último en terminar despierta al hilo principal
+        if (atomic_fetch_sub_explicit(&pool->remaining, 1, memory_order_acq_rel) == 1 &&
+            pool->handoff == HANDOFF_FUTEX)
+            FutexWake(&pool->remaining);
+    }
+
+    if (pool->stop != NULL)
+        pool->stop(self->id);
+    return NULL;
+}
+
+int workers_parse_handoff(const char* text, enum workers_handoff* handoff) {
+    if (strcmp(text, "spin") == 0)
+        *handoff = HANDOFF_SPIN;
+    else if (strcmp(text, "futex") == 0)
+        *handoff = HANDOFF_FUTEX;
+    else
+        return -1;
+    return 0;
+}
+
+// Publicar una fase (fn NULL = terminar) y despertar a los hilos
+static void Publish(struct worker_pool* pool, void* (*fn)(void*), void* args, size_t stride) {
+    pool->fn = fn;
+    pool->args = (char*)args;
+    pool->stride = stride;
+    atomic_store_explicit(&pool->remaining, (unsigned)pool->ths, memory_order_relaxed);
+    atomic_fetch_add_explicit(&pool->generation, 1, memory_order_release);
+    if (pool->handoff == HANDOFF_FUTEX)
+        FutexWake(&pool->generation);
+}
+
+struct worker_pool* workers_create(int ths, enum workers_handoff handoff,
+                                   void (*start)(int id), void (*stop)(int id)) {
+    struct worker_pool* pool = aligned_alloc(64, sizeof(struct worker_pool));
+    if (pool == NULL)
+        return NULL;
+    pool->ths = ths;
+    pool->handoff = handoff;
+    pool->start = start;
+    pool->stop = stop;
+    pool->fn = NULL;
+    pool->args = NULL;
+    pool->stride = 0;
+    atomic_init(&pool->generation, 0);
+    atomic_init(&pool->remaining, 0);
+    pool->workers = malloc((size_t)ths * sizeof(struct worker));
+    if (pool->workers == NULL) {
+        free(pool);
+        return NULL;
+    }
+
+    for (int i = 0; i < ths; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].id = i;
+        if (pthread_create(&pool->workers[i].thread, NULL, Worker, &pool->workers[i]) != 0) {
+            // Terminar los que ya arrancaron
+            pool->ths = i;
+            workers_destroy(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+void workers_start(struct worker_pool* pool, void* (*fn)(void*), void* args, size_t stride) {
+    Publish(pool, fn, args, stride);
+}
+
+void workers_wait(struct worker_pool* pool) {
+    unsigned left;
+    unsigned spins = 0;
+    while ((left = atomic_load_explicit(&pool->remaining, memory_order_acquire)) != 0) {
+        if (pool->handoff == HANDOFF_FUTEX)
+            FutexWait(&pool->remaining, left);
+        else
+            spin_relax(&spins);
+    }
+}
+
+void workers_destroy(struct worker_pool* pool) {
+    Publish(pool, NULL, NULL, 0);
+    for (int i = 0; i < pool->ths; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    free(pool->workers);
+    free(pool);
+}
@@ -0,0 +1,38 @@
+#ifndef WORKERS_H
+#define WORKERS_H
+
+#include <stddef.h>     // Para size_t
+
+// Hilos de trabajo persistentes: se crean una vez por corrida y ejecutan
+// una fase detrás de otra (carga, búsqueda, mezcla, vaciado) sin volver a
+// crearse. El hilo principal publica la fase y espera a que todos la
+// terminen.
+//
+//   spin   los hilos esperan la próxima fase (y el principal el final)
+//          girando sobre un contador; el traspaso es inmediato pero ocupa
+//          la CPU entre fases
+//   futex  duermen en el kernel sobre el mismo contador (futex) y se los
+//          despierta al publicar la fase
+
+enum workers_handoff { HANDOFF_SPIN, HANDOFF_FUTEX };
+
+struct worker_pool;
+
+// Leer "spin" o "futex". Devuelve 0 si es válido.
+int workers_parse_handoff(const char* text, enum workers_handoff* handoff);
+
+// Crear `ths` hilos. Cada uno ejecuta start(id) al empezar y stop(id) al
+// terminar (pueden ser NULL). NULL si no se pudieron crear.
+struct worker_pool* workers_create(int ths, enum workers_handoff handoff,
+                                   void (*start)(int id), void (*stop)(int id));
+
+// Lanzar fn(args + id * stride) en cada hilo sin esperar
+void workers_start(struct worker_pool* pool, void* (*fn)(void*), void* args, size_t stride);
+
+// Esperar a que todos terminen la fase lanzada
+void workers_wait(struct worker_pool* pool);
+
+// Terminar los hilos (ejecutan stop) y liberar el grupo
+void workers_destroy(struct worker_pool* pool);
+
+#endif
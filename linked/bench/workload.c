@@ -0,0 +1,176 @@
+#include <stdio.h>      // Para funciones de entrada/salida
+#include <stdlib.h>     // Para funciones de manejo de memoria
+#include <string.h>     // Para strcmp y strncmp
+#include <math.h>       // Para fabs, llround y pow
+
+#include "workload.h"
+
+const char* const op_names[OP_COUNT] = { "Member", "Insert", "Delete" };
+
+// Leer "member/insert/delete" en porcentajes
+int workload_parse_mix(const char* text, struct workload* w) {
+    double member, insert, del;
+    char extra;
+    if (sscanf(text, "%lf/%lf/%lf%c", &member, &insert, &del, &extra) != 3)
+        return -1;
+    if (member < 0 || insert < 0 || del < 0)
+        return -1;
+    if (fabs(member + insert + del - 100.0) > 1e-6)
+        return -1; // Los porcentajes deben sumar 100
+
+    w->member_thresh = (unsigned)llround(member * WORKLOAD_SCALE / 100.0);
+    w->insert_thresh = (unsigned)llround((member + insert) * WORKLOAD_SCALE / 100.0);
+    return 0;
+}
+
+// Claves iniciales: las primeras w->initial de una permutación aleatoria del rango
+int* workload_initial_keys(const struct workload* w) {
+    int* keys = malloc((size_t)w->key_range * sizeof(int));
+    if (keys == NULL)
+        return NULL;
+    for (int i = 0; i < w->key_range; i++) {
+        keys[i] = i;
+    }
+
+    // Fisher-Yates parcial: sólo hace falta mezclar las primeras posiciones
+    uint64_t state = workload_thread_seed(w, -1);
+    for (int i = 0; i < w->initial; i++) {
+        int j = i + (int)((workload_rand(&state) >> 32) % (uint64_t)(w->key_range - i));
+        int tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    return keys;
+}
+
+// Semilla del hilo `id` (splitmix64 sobre la semilla base, nunca 0)
+uint64_t workload_thread_seed(const struct workload* w, int id) {
+    uint64_t z = w->seed + 0x9E3779B97F4A7C15ULL * (uint64_t)(id + 2);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    return z != 0 ? z : 1;
+}
+
+// Leer la distribución de las claves
+int workload_parse_dist(const char* text, struct workload* w) {
+    char extra;
+    if (strcmp(text, "uniform") == 0) {
+        w->dist = KEY_UNIFORM;
+    } else if (strcmp(text, "sequential") == 0) {
+        w->dist = KEY_SEQUENTIAL;
+    } else if (strcmp(text, "zipf") == 0) {
+        w->dist = KEY_ZIPF;
+    } else if (strncmp(text, "zipf:", 5) == 0) {
+        double skew;
+        if (sscanf(text + 5, "%lf%c", &skew, &extra) != 1 || skew <= 0.0 || skew >= 1.0)
+            return -1;
+        w->dist = KEY_ZIPF;
+        w->zipf_skew = skew;
+    } else if (strcmp(text, "hotspot") == 0) {
+        w->dist = KEY_HOTSPOT;
+    } else if (strncmp(text, "hotspot:", 8) == 0) {
+        double keys, ops;
+        if (sscanf(text + 8, "%lf/%lf%c", &keys, &ops, &extra) != 2)
+            return -1;
+        if (keys <= 0.0 || keys > 100.0 || ops < 0.0 || ops > 100.0)
+            return -1;
+        w->dist = KEY_HOTSPOT;
+        w->hot_keys = keys / 100.0;
+        w->hot_ops = ops / 100.0;
+    } else {
+        return -1;
+    }
+    return 0;
+}
+
+const char* workload_dist_name(const struct workload* w) {
+    switch (w->dist) {
+    case KEY_UNIFORM:    return "uniform";
+    case KEY_ZIPF:       return "zipf";
+    case KEY_HOTSPOT:    return "hotspot";
+    case KEY_SEQUENTIAL: return "sequential";
+    }
+    return "?";
+}
+
+static uint64_t Gcd(uint64_t a, uint64_t b) {
+    while (b != 0) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Constantes de zipf (Gray et al., "Quickly generating billion-record
+// synthetic databases"): zeta(n) se calcula una vez, cada clave cuesta un pow
+void workload_prepare(struct workload* w) {
+    if (w->dist != KEY_ZIPF)
+        return;
+
+    uint64_t n = (uint64_t)w->key_range;
+    double theta = w->zipf_skew;
+    double zetan = 0.0;
+    for (uint64_t i = 1; i <= n; i++) {
+        zetan += 1.0 / pow((double)i, theta);
+    }
+    double zeta2 = 1.0 + pow(0.5, theta);
+
+    w->zipf_zetan = zetan;
+    w->zipf_alpha = 1.0 / (1.0 - theta);
+    w->zipf_two = zeta2;
+    w->zipf_eta = n > 2 ? (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / zetan) : 0.0;
+
+    // Paso de la permutación: cerca de n * 0.618 y coprimo con n
+    uint64_t mult = (uint64_t)(n * 0.6180339887) | 1;
+    while (n > 1 && Gcd(mult, n) != 1)
+        mult++;
+    w->zipf_mult = mult;
+}
+
+void workload_stream_init(const struct workload* w, struct key_stream* s, int id, int ths) {
+    s->rng = workload_thread_seed(w, id);
+    // Cada hilo empieza su recorrido secuencial en un tramo distinto
+    s->next = ths > 0 ? (long)w->key_range * id / ths : 0;
+}
+
+int workload_skewed_key(const struct workload* w, struct key_stream* s) {
+    uint64_t n = (uint64_t)w->key_range;
+
+    switch (w->dist) {
+    case KEY_ZIPF: {
+        double u = workload_uniform(&s->rng);
+        double uz = u * w->zipf_zetan;
+        uint64_t rank;
+        if (uz < 1.0)
+            rank = 0;
+        else if (uz < w->zipf_two)
+            rank = 1;
+        else
+            rank = (uint64_t)(n * pow(w->zipf_eta * u - w->zipf_eta + 1.0, w->zipf_alpha));
+        if (rank >= n)
+            rank = n - 1;
+        return (int)(rank * w->zipf_mult % n);
+    }
+    case KEY_HOTSPOT: {
+        uint64_t hot = (uint64_t)(n * w->hot_keys);
+        if (hot == 0)
+            hot = 1;
+        uint64_t first = (n - hot) / 2;
+        uint64_t r = workload_rand(&s->rng) >> 32;
+        if (hot == n || workload_uniform(&s->rng) < w->hot_ops)
+            return (int)(first + r % hot);
+        // Clave fría: saltar el tramo caliente
+        uint64_t cold = r % (n - hot);
+        return (int)(cold < first ? cold : cold + hot);
+    }
+    case KEY_SEQUENTIAL: {
+        long key = s->next;
+        s->next = key + 1 < (long)n ? key + 1 : 0;
+        return (int)key;
+    }
+    default:
+        return (int)((workload_rand(&s->rng) >> 32) % n);
+    }
+}
@@ -0,0 +1,117 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+#include <stdint.h>     // Para uint64_t
+
+// Generador de carga mixta: cada hilo elige la siguiente operación según
+// los porcentajes Member/Insert/Delete y una clave dentro de [0, key_range).
+//
+// Distribuciones de las claves (--dist):
+//
+//   uniform     todas las claves igual de probables
+//   zipf:S      la clave de rango r sale con probabilidad ~ 1/r^S (0 < S < 1).
+//               Los rangos se reparten por todo el intervalo con una
+//               permutación fija, así las claves populares no quedan todas
+//               al principio de la lista.
+//   hotspot:K/O el O % de las operaciones va a un tramo contiguo con el K %
+//               de las claves, en el medio del intervalo
+//   sequential  cada hilo recorre las claves en orden ascendente desde su
+//               propio punto de partida
+
+// Los porcentajes se guardan como umbrales sobre WORKLOAD_SCALE (0.0001 %)
+#define WORKLOAD_SCALE 1000000u
+
+enum op_type { OP_MEMBER, OP_INSERT, OP_DELETE, OP_COUNT };
+
+enum key_dist { KEY_UNIFORM, KEY_ZIPF, KEY_HOTSPOT, KEY_SEQUENTIAL };
+
+struct workload {
+    unsigned member_thresh;   // r < member_thresh -> Member
+    unsigned insert_thresh;   // r < insert_thresh -> Insert, si no Delete
+    int key_range;            // Claves en [0, key_range)
+    int initial;              // Elementos insertados antes de la fase mixta
+    long ops;                 // Operaciones mixtas en total (entre todos los hilos)
+    uint64_t seed;            // Semilla base de los generadores por hilo
+
+    enum key_dist dist;       // Distribución de las claves (--dist)
+    double zipf_skew;         // zipf: exponente S
+    double hot_keys;          // hotspot: fracción de las claves que es caliente
+    double hot_ops;           // hotspot: fracción de las operaciones que va a ellas
+    double hit_rate;          // Fase de búsqueda: fracción de claves presentes (--hit-rate)
+
+    // Calculado por workload_prepare para el key_range actual
+    double zipf_zetan;        // zeta(key_range, S)
+    double zipf_eta;
+    double zipf_alpha;        // 1 / (1 - S)
+    double zipf_two;          // 1 + 0.5^S (umbral del segundo rango)
+    uint64_t zipf_mult;       // Permutación rango -> clave (coprimo con key_range)
+};
+
+// Estado del generador de claves de un hilo
+struct key_stream {
+    uint64_t rng;
+    long next;                // sequential: próxima clave
+};
+
+// Nombre de cada tipo de operación
+extern const char* const op_names[OP_COUNT];
+
+// Leer "member/insert/delete" en porcentajes (p. ej. 80/10/10). Devuelve 0 si es válido.
+int workload_parse_mix(const char* text, struct workload* w);
+
+// Leer la distribución: "uniform", "zipf[:S]", "hotspot[:K/O]" o
+// "sequential". Devuelve 0 si es válida.
+int workload_parse_dist(const char* text, struct workload* w);
+
+// Nombre de la distribución (para los informes)
+const char* workload_dist_name(const struct workload* w);
+
+// Precalcular las constantes de la distribución para w->key_range (hay
+// que llamarla de nuevo si cambia el rango)
+void workload_prepare(struct workload* w);
+
+// Generador de claves del hilo `id` de `ths`
+void workload_stream_init(const struct workload* w, struct key_stream* s, int id, int ths);
+
+// Claves iniciales distintas elegidas al azar en [0, key_range) (w->initial elementos)
+int* workload_initial_keys(const struct workload* w);
+
+// Semilla del generador del hilo `id`
+uint64_t workload_thread_seed(const struct workload* w, int id);
+
+// Generador xorshift64*: barato y sin estado compartido entre hilos
+static inline uint64_t workload_rand(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+// Siguiente operación de la mezcla
+static inline enum op_type workload_next_op(const struct workload* w, uint64_t* state) {
+    unsigned r = (unsigned)((workload_rand(state) >> 32) % WORKLOAD_SCALE);
+    if (r < w->member_thresh)
+        return OP_MEMBER;
+    if (r < w->insert_thresh)
+        return OP_INSERT;
+    return OP_DELETE;
+}
+
+// Número uniforme en [0, 1)
+static inline double workload_uniform(uint64_t* state) {
+    return (workload_rand(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Clave de las distribuciones no uniformes (workload.c)
+int workload_skewed_key(const struct workload* w, struct key_stream* s);
+
+// Siguiente clave en [0, key_range) según la distribución
+static inline int workload_next_key(const struct workload* w, struct key_stream* s) {
+    if (w->dist == KEY_UNIFORM)
+        return (int)((workload_rand(&s->rng) >> 32) % (uint64_t)w->key_range);
+    return workload_skewed_key(w, s);
+}
+
+#endif
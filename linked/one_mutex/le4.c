@@ -205,7 +205,7 @@ int main() {
     int elements_to_search[consulta];
 
     for (int i = 0; i < consulta; i++) {
-        elements_to_search[i] = i * (total_elements / consulta);
+        elements_to_search[i] = (int)((long)i * total_elements / consulta);
     }
 
     for (int i = 0; i < ths; i++) {
@@ -181,7 +181,7 @@ int main() {
 
     // Rellenar el array con elementos secuenciales para la búsqueda
     for (int i = 0; i < consulta; i++) {
-        elements_to_search[i] = i * (total_elements / consulta); // Buscar cada n-ésimo elemento
+        elements_to_search[i] = (int)((long)i * total_elements / consulta); // Buscar cada n-ésimo elemento
     }
 
     // Hilos para búsqueda